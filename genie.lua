@@ -1,8 +1,25 @@
 os.execute("mkdir bin")
 os.execute("cp -r dll/x64/* bin/")
 
+newoption {
+  trigger = "sse",
+  description = "Build MathLib with its SSE implementation (ML_USE_SSE)"
+}
+
+newoption {
+  trigger = "fast-math",
+  description = "Use MathLib's approximate normalize, atan2, sin/cos and angle wrap (ML_FAST_MATH)"
+}
+
+newoption {
+  trigger = "no-profiler",
+  description = "Compile out the PROFILE_SCOPE instrumentation (PROFILER_ENABLED=0)"
+}
+
 local project_list = {
-  "EJ02.Steering"
+  "EJ02.Steering",
+  "MathLib.Bench",
+  "Steering.Bench"
 }
 
 local function new_project(name)
@@ -35,6 +52,20 @@ local function new_project(name)
     configuration {"windows"}
       flags {"NoEditAndContinue"}
       windowstargetplatformversion "10.0.17134.0"
+    if _OPTIONS["sse"] then
+      configuration {}
+        defines {"ML_USE_SSE=1"}
+      configuration {"not windows"}
+        buildoptions {"-msse3"}
+    end
+    if _OPTIONS["fast-math"] then
+      configuration {}
+        defines {"ML_FAST_MATH=1"}
+    end
+    if _OPTIONS["no-profiler"] then
+      configuration {}
+        defines {"PROFILER_ENABLED=0"}
+    end
 end
 
 solution "05MVID"
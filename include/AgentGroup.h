@@ -1,10 +1,13 @@
 #pragma once
 
 #include <agent.h>
+#include <kinematic_store.h>
+#include <random.h>
+#include <spatial_grid.h>
 
 #include <cstdint>
-
-#define N_AGENTS 10
+#include <memory>
+#include <vector>
 
 class World;
 
@@ -13,14 +16,51 @@ public:
   AgentGroup() {};
   ~AgentGroup() {};
 
-  void init(World* world, const Body::Color color, const Body::Type type);
+  void init(World* world, const Body::Color color, const Body::Type type, const uint32_t count);
   void update(const uint32_t dt);
-  void render() const;
+  void recordDebug() const;
   void shutdown();
   void setSteering(Body::SteeringMode steering);
   Agent* getAgent(int i);
+  uint32_t size() const { return (uint32_t)agents_.size(); }
+  Body::Color color() const { return color_; }
+
+  //makes room for count agents without reallocating
+  void reserve(const uint32_t count);
+  //spawns a new agent around the center of the world
+  Agent* addAgent();
+  //removes agent i, the last agent takes its index
+  void removeAgent(const uint32_t i);
+
+  //state at the start of the current update, what every agent reads
+  const KinematicStore& kinematics() const { return kinematic_.front(); }
+  //state one update earlier, between updates
+  const KinematicStore& previousKinematics() const { return kinematic_.previous(); }
+
+  //calls fn(index) for the agents that may lie within radius of pos,
+  //using the grid rebuilt at the start of the current update
+  template <typename Fn>
+  void forEachCandidate(const MathLib::Vec2& pos, const float radius, Fn fn) const {
+    grid_.forEachCandidate(pos, radius, fn);
+  }
 
 private:
+  void rebuildGrid();
+  //counting sort of the agent indices by steering mode into order_
+  void bucketByMode();
+
   World * world_;
-  Agent agents_[N_AGENTS];
+  Body::Color color_;
+  Body::Type type_;
+  Body::SteeringMode steering_mode_ = Body::SteeringMode::Kinematic_Seek;
+
+  std::vector<uint32_t> order_;                    //agent indices grouped by steering mode
+  uint32_t bucket_begin_[Body::steering_modes_ + 1];     //mode m owns order_[bucket_begin_[m], bucket_begin_[m + 1])
+  std::vector<float> gather_[4];                   //batched input in order_ order: pos x, pos y, vel x, vel y
+  std::vector<float> steering_x_;                  //batched steering output, in order_ order
+  std::vector<float> steering_y_;
+  std::vector<std::unique_ptr<Agent>> agents_;    //agents keep their address, Mind and targets point to them
+  KinematicBuffer kinematic_;
+  SpatialGrid grid_;
+  Random rng_;                                     //spawn positions
 };
\ No newline at end of file
@@ -15,21 +15,27 @@
 
 class World;
 class AgentGroup;
+class KinematicBuffer;
 
 class Agent {
   public:
     Agent() {};
     ~Agent() {};
 
-    void init(World* world, const Body::Color color, const Body::Type type);
+    void init(World* world, const Body::Color color, const Body::Type type, KinematicBuffer* kinematic);
     void update(const uint32_t dt);
-    void render() const;
+    void update(const uint32_t dt, const KinematicStatus& target);
+    void update(const uint32_t dt, const Steering& steering);
+    void recordDebug() const { body_.recordDebug(); }
     void shutdown();
 
     void setSteering(Body::SteeringMode steering) { body_.setSteering(steering); }   
+    Body::SteeringMode getSteering() const { return body_.getSteering(); }
     void setAgentGroup(AgentGroup* ag) { body_.setAgentGroup(ag); }
-    const KinematicStatus* getKinematic() const { return body_.getKinematic(); }
-    KinematicStatus* getKinematic() { return body_.getKinematic(); }
+    KinematicStatus getKinematic() const { return body_.getKinematic(); }
+    void setKinematic(const KinematicStatus& status) { body_.setKinematic(status); }
+    uint32_t getKinematicIndex() const { return body_.getKinematicIndex(); }
+    void setKinematicIndex(const uint32_t index) { body_.setKinematicIndex(index); }
   private:
     World * world_;
 
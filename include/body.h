@@ -8,12 +8,14 @@
 #ifndef __BODY_H__
 #define __BODY_H__ 1
 
-#include <sprite.h>
 #include <defines.h>
+#include <random.h>
 #include <mathlib/vec2.h>
 
 class Agent;
 class AgentGroup;
+class KinematicBuffer;
+class KinematicStore;
 
 class Body {
   public:
@@ -48,27 +50,49 @@ class Body {
       Alignment,              //c
       Flocking,               //v
     };
+    static constexpr uint32_t steering_modes_ = (uint32_t)SteeringMode::Flocking + 1;
 
     Body() {};
     ~Body() {};
 
-    void init(const Color color, const Type type);
+    void init(const Color color, const Type type, KinematicBuffer* kinematic);
     void update(const uint32_t dt);
-    void render() const;
-
+    //same as update(dt) with the target state fetched once by the caller
+    void update(const uint32_t dt, const KinematicStatus& target);
+    //integrates a steering computed by the group instead of running the behaviour
+    void update(const uint32_t dt, const Steering& steering);
+    //records the debug vectors and the position trail of this body in DebugDraw
+    void recordDebug() const;
+
+    //true when mode has a batched version, see steerBatch
+    static bool hasBatch(const SteeringMode mode);
+    //batched behaviours, writes the linear steering of count agents gathered
+    //into contiguous arrays, all of them running mode towards target
+    static void steerBatch(const SteeringMode mode, const uint32_t count, const float* pos_x, const float* pos_y,
+      const float* vel_x, const float* vel_y, const KinematicStatus& target, float* linear_x, float* linear_y);
+    //enumerator name, a string literal
+    static const char* steeringName(const SteeringMode mode);
+    static const char* spritePath(const Color color);
+
+    //every body draws from its own stream, so results do not depend on update order
+    void seedRandom(const uint64_t seed, const uint64_t stream) { rng_.seed(seed, stream); }
     void setTarget(Agent* target);
     void setAgentGroup(AgentGroup* ag) { agentGroup_ = ag; };
     void setSteering(const SteeringMode mode) { steering_mode_ = mode; };
-    const KinematicStatus* getKinematic() const { return &state_; }
-    KinematicStatus* getKinematic() { return &state_; }
+    SteeringMode getSteering() const { return steering_mode_; }
+    KinematicStatus getKinematic() const;
+    void setKinematic(const KinematicStatus& status);
+    uint32_t getKinematicIndex() const { return index_; }
+    void setKinematicIndex(const uint32_t index) { index_ = index; }
   private:
-    void updateManual(const uint32_t);
-    void setOrientation(const MathLib::Vec2& velocity);
-    void keepInSpeed();
-    void keepInBounds();
-
-    void applyKinematicSteering(const KinematicSteering& steering, const uint32_t ms);
-    void applySteering(const Steering& steering, const uint32_t ms);
+    void finishUpdate(const KinematicStatus& state);
+    void updateManual(const uint32_t, KinematicStatus* state);
+    void setOrientation(const MathLib::Vec2& velocity, KinematicStatus* state) const;
+    void keepInSpeed(KinematicStatus* state) const;
+    void keepInBounds(KinematicStatus* state) const;
+
+    void applyKinematicSteering(const KinematicSteering& steering, const uint32_t ms, KinematicStatus* state);
+    void applySteering(const Steering& steering, const uint32_t ms, KinematicStatus* state);
     
     void kinematicSeek(const KinematicStatus& character, const KinematicStatus* target, KinematicSteering* steering) const;
     void kinematicFlee(const KinematicStatus& character, const KinematicStatus* target, KinematicSteering* steering) const;
@@ -83,29 +107,55 @@ class Body {
     void pursue(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const;
     void face(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const;
     void lookGoing(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const;
-    void wander(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const;
+    //wander_orientation is the agent's wander angle, advanced every call
+    void wander(const KinematicStatus& character, const KinematicStatus* target, Steering* steering, float* wander_orientation) const;
     void separation(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const;
     void cohesion(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const;
     void alignment(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const;
     void flocking(const KinematicStatus& character, AgentGroup* agentGroup, const KinematicStatus* target, Steering* steering) const;
 
-    Sprite sprite_;
+    //separation, cohesion and alignment sums from one scan of the neighbours
+    struct FlockTerms {
+      MathLib::Vec2 separation;
+      MathLib::Vec2 cohesion;             //offsets to the neighbours, self excluded
+      int cohesion_total = 0;
+      float alignment = 0.0f;             //orientation deltas, self included
+      int alignment_total = 0;
+    };
+    void flockTerms(const KinematicStatus& character, AgentGroup* agentGroup, FlockTerms* terms) const;
+
     Type type_;
     Color color_;
     SteeringMode steering_mode_;
     Agent* target_;
     AgentGroup * agentGroup_;
 
-    const float max_speed_ = 100.0f;
+    static constexpr float max_speed_ = 100.0f;
+
+    //one entry per SteeringMode in enum order, so picking a behaviour is an index
+    struct Behaviour {
+      const char* name;
+      bool kinematic;         //steer writes kinematic_steering instead of steering
+      //character is this tick's state, behaviours with per-agent memory (wander) advance it
+      void (*steer)(const Body& body, KinematicStatus& character, const KinematicStatus& target,
+        KinematicSteering* kinematic_steering, Steering* steering);
+      void (*batch)(const uint32_t count, const float* pos_x, const float* pos_y, const float* vel_x,
+        const float* vel_y, const float tx, const float ty, float* linear_x, float* linear_y);  //nullptr without one
+    };
+    static const Behaviour behaviours_[steering_modes_];
 
-    struct {
+    mutable struct {                           //debug draw data, written by the const behaviours too
       struct {
         MathLib::Vec2 pos;
         MathLib::Vec2 v;
       } green, red, blue;
+      MathLib::Vec2 wander;
     } dd;
 
-    KinematicStatus state_;
+    mutable Random rng_;                      //advanced by the const behaviours
+
+    KinematicBuffer* kinematic_ = nullptr;    //kinematic state lives in the buffer, index_ is our slot
+    uint32_t index_ = 0;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __COMMAND_H__
+#define __COMMAND_H__ 1
+
+#include <cstdint>
+
+//player input that changes the simulation, queued and applied by the world
+//at the start of the tick it is stamped with
+struct Command {
+  enum class Type : uint8_t {
+    TargetPosition,         //x, y
+    TargetSpeed,            //x is added to the target speed
+    TargetOrientation,      //x is added to the target orientation
+    Steering,               //mode is a Body::SteeringMode for the group
+  };
+
+  uint32_t tick{ 0 };
+  Type type{ Type::TargetPosition };
+  float x{ 0.0f };
+  float y{ 0.0f };
+  int32_t mode{ 0 };
+};
+
+#endif
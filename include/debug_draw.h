@@ -8,37 +8,24 @@
 #ifndef __DEBUG_DRAW_H__
 #define __DEBUG_DRAW_H__ 1
 
+#include <SDL/SDL.h>
+
+#include <atomic>
+#include <unordered_map>
 #include <vector>
+#include <frame_arena.h>
 #include <mathlib/vec2.h>
 using MathLib::Vec2;
 
+//the draw* calls record on the simulation thread, capture() hands what was
+//recorded to a Frame that the render thread draws as many times as it needs
 class DebugDraw {
   public:
-    DebugDraw() {};
-    ~DebugDraw() {};
-
-    static void render();
-
-    static void drawVector(const Vec2& pos, const Vec2& v,
-      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
-    static void drawCross(const Vec2& pos,
-      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
-    static void drawPositionHist(const Vec2& pos);
-
-    static void toggleEnabled() { enabled_ = !enabled_; };
-  private:
-    static void renderVector(const Vec2& pos, const Vec2& v,
-      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
-    static void renderCross(const Vec2& pos,
-      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
-    static void renderPositionHist();
-
-    static bool enabled_;
-    static float delta_;
-
-#define MAX_HIST 1000
-    static uint16_t hist_idx_;
-    static Vec2 hist_[MAX_HIST];
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    typedef SDL_FPoint Point;
+#else
+    typedef SDL_Point Point;
+#endif
 
     enum class CommandType {
       Vector,
@@ -53,9 +40,70 @@ class DebugDraw {
       uint8_t g;
       uint8_t b;
       uint8_t a;
+
+      uint32_t color() const { return ((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | a; }
+    };
+
+    struct TrailBucket {
+      uint32_t color;
+      std::vector<Point> points;
     };
 
-    static std::vector<Command> command_list_;
+    //debug geometry of one simulation frame, ready to draw
+    struct Frame {
+      FrameArena<Command> commands;       //sorted by colour
+      std::vector<TrailBucket> trails;    //every trail point, one list per colour
+      //recording arena usage when the frame was captured, see FrameArena
+      uint32_t command_capacity = 0;
+      uint32_t command_peak = 0;
+      uint32_t command_grows = 0;
+    };
+
+    DebugDraw() {};
+    ~DebugDraw() {};
+
+    //moves the recorded commands and the current trails into frame and starts a new frame
+    static void capture(Frame* frame);
+    //draws a captured frame without changing it
+    static void render(const Frame& frame);
+
+    static void drawVector(const Vec2& pos, const Vec2& v,
+      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
+    static void drawCross(const Vec2& pos,
+      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
+    //appends pos to the trail of owner, each owner keeps its last trail length positions.
+    //nothing is kept while disabled, the trails restart when debug draw is turned on
+    static void drawPositionHist(const void* owner, const Vec2& pos,
+      const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a);
+    //drops the recorded trails when the length changes
+    static void setTrailLength(const uint16_t length);
+
+    static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+    static void toggleEnabled() { enabled_.store(!isEnabled(), std::memory_order_relaxed); };
+  private:
+    //commands are drawn grouped by colour, one draw colour change per group
+    //and one polyline per command
+    static void renderCommands(const Frame& frame);
+    //one SDL_RenderDrawPoints per colour
+    static void renderPositionHist(const Frame& frame);
+    //gathers the trails per colour, trails not fed since the last capture are dropped
+    static void captureTrails(Frame* frame);
+
+    static std::atomic<bool> enabled_;
+    static float delta_;
+
+    struct Trail {
+      std::vector<Vec2> points;     //ring, next is the oldest once it is full
+      uint16_t next;
+      uint32_t frame;               //last frame the owner added a position
+      uint32_t color;
+    };
+
+    static uint16_t trail_length_;
+    static uint32_t frame_;
+    static std::unordered_map<const void*, Trail> trails_;
+
+    static FrameArena<Command> commands_;   //recorded while enabled, emptied by capture()
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -20,8 +20,18 @@
 #define WINDOW_HEIGHT 800
 
 #define TICKS_PER_SECOND 30
+#define TICK_MS (1000 / TICKS_PER_SECOND)   //fixed simulation step, slow motion stretches wall time instead
 #define MAX_FRAME_SKIP 10
 
+#define DEFAULT_N_AGENTS 10          //overridden by the first command line argument
+#define UPDATE_GRAIN 256              //agents per worker pool chunk
+#define NEIGHBOUR_RADIUS 100.0f      //group behaviours, also the spatial grid cell size
+#define DEBUG_DRAW_COMMANDS 4096     //debug draw commands reserved up front, the arena grows past it if needed
+#define TRAIL_LENGTH 100             //debug draw positions kept per agent, --trail overrides it
+#define PROFILER_EVENTS 16384        //timed scopes kept per thread
+#define PROFILER_SUMMARY_LINES 8     //slowest scopes shown on screen
+#define PROFILE_FILE "profile.json"  //F6 writes the chrome trace here
+
 #define FOREGROUND_COLOR { 0, 0, 0, 255 }
 #define SHADOW_COLOR {160, 160, 160, 255}
 
@@ -39,6 +49,7 @@ struct KinematicStatus {
   MathLib::Vec2 velocity{ 0.0f, 0.0f };  //linear velocity
   float rotation{0.0f};               //angular velocity
   float speed{ 0.0f };
+  float wander{ 0.0f };               //wander angle around the heading, advanced by Wander
 };
 
 struct KinematicSteering {
@@ -64,17 +75,14 @@ inline MathLib::Vec2 rotate2D(const MathLib::Vec2& pivot, const MathLib::Vec2& p
     s * (point.x() - pivot.x()) + c * (point.y() - pivot.y()) + pivot.y());
 }
 
-//random value between two numbers
-inline float randomFloat(float a, float b) {
-  const float random = ((float)rand()) / (float)RAND_MAX;
-  return a + (random * (b - a));
+//wrap an angle between [-PI, PI), approximated under ML_FAST_MATH
+inline float wrapAnglePI(double x) {
+  return MathLib::wrapAngle(x);
 }
 
-//wrap an angle between [-PI, PI)
-inline float wrapAnglePI(double x) {
-  x = fmod(x + M_PI, M_PI * 2.0f);
-  if (x < 0) x += M_PI * 2.0f;
-  return x - M_PI;
+//blends angle a towards b by t along the shortest arc
+inline float lerpAngle(const float a, const float b, const float t) {
+  return a + (wrapAnglePI(b - a) * t);
 }
 
 //returns (-1, 0 , 1), the sign of the number
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __FRAME_ARENA_H__
+#define __FRAME_ARENA_H__ 1
+
+#include <cstdint>
+#include <vector>
+
+//linear storage that is reset every frame without giving its memory back,
+//once it has held the busiest frame it does not allocate anymore
+template<typename T>
+class FrameArena {
+  public:
+    FrameArena() {};
+    explicit FrameArena(const uint32_t capacity) { reserve(capacity); };
+    ~FrameArena() {};
+
+    //slot for one more element this frame, grows the storage when it is full
+    T* alloc() {
+      if (size_ == capacity()) {
+        reserve((size_ > 0) ? (size_ * 2) : 64);
+      }
+      return &data_[size_++];
+    }
+
+    //forgets this frame's elements, keeping the storage
+    void reset() {
+      if (size_ > peak_) peak_ = size_;
+      size_ = 0;
+    }
+
+    void reserve(const uint32_t capacity) {
+      if (capacity > data_.size()) {
+        data_.resize(capacity);
+        ++grows_;
+      }
+    }
+
+    T* begin() { return data_.data(); }
+    T* end() { return data_.data() + size_; }
+    const T* begin() const { return data_.data(); }
+    const T* end() const { return data_.data() + size_; }
+    T& operator[](const uint32_t i) { return data_[i]; }
+    const T& operator[](const uint32_t i) const { return data_[i]; }
+
+    uint32_t size() const { return size_; }
+    uint32_t capacity() const { return (uint32_t)data_.size(); }
+    uint32_t peak() const { return (size_ > peak_) ? size_ : peak_; }     //most elements held in one frame
+    uint32_t grows() const { return grows_; }                            //times the storage was allocated
+  private:
+    std::vector<T> data_;
+    uint32_t size_ = 0;
+    uint32_t peak_ = 0;
+    uint32_t grows_ = 0;
+};
+
+#endif
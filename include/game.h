@@ -8,30 +8,61 @@
 #ifndef __GAME_H__
 #define __GAME_H__ 1
 
-#include <sprite.h>
+#include <glyph_atlas.h>
 #include <defines.h>
+#include <command.h>
+#include <input_log.h>
+#include <snapshot.h>
+#include <sprite.h>
+#include <sprite_batch.h>
 #include <world.h>
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 class Game {
   public:
     Game() {};
     ~Game() {};
 
-    void init();
+    //log records or replays the session, it must outlive the game
+    void init(const uint32_t n_agents, const uint64_t seed, InputLog* log);
+    //input and rendering on the calling thread, the simulation on its own
     void start();
     void shutdown();
   private:
+    //simulation thread, fixed steps paced by wall time, one snapshot per batch of ticks
+    void simulate();
     void handleInput();
-    void update(const uint32_t dt);
-    void render();
+    void update();
+    void render(const Snapshot& snapshot);
 
-    bool quit_ = false;
-    Sprite fps_sprite_;
+    //queues a command for the next tick
+    void queue(const Command::Type type, const float x, const float y = 0.0f, const int32_t mode = 0);
+    void queueSteering(const Body::SteeringMode mode, const char* name);
+
+    std::atomic<bool> quit_{ false };
+    GlyphAtlas hud_font_;
+    char hud_text_[1024] = "";      //stats and profiler summary, refreshed every 100 frames
     TTF_Font* font_ = nullptr;
+    Sprite agent_sprites_[4];       //one per Body::Color
+    SpriteBatch batch_;
+    uint32_t n_agents_ = 0;
+    bool report_debug_stats_ = false;   //F5, render() prints the arena stats of the next snapshot
 
+    //owned by the simulation thread once start() runs
     World world_;
+    InputLog* log_ = nullptr;
+    std::vector<Command> tick_commands_;
+
+    SnapshotExchange snapshots_;
+    std::mutex commands_mutex_;     //guards commands_, queued by input and taken by update()
+    std::vector<Command> commands_;
+    std::atomic<uint32_t> update_loops_{ 0 };
+    std::atomic<uint64_t> update_counter_{ 0 };   //performance counter ticks spent in update()
 
-    int8_t slo_mo_ = 1;
+    std::atomic<int8_t> slo_mo_{ 1 };
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __GLYPH_ATLAS_H__
+#define __GLYPH_ATLAS_H__ 1
+
+#include <SDL/SDL.h>
+#include <SDL/SDL_ttf.h>
+
+#include <vector>
+
+//printable ascii glyphs of a font rasterised once into a single texture,
+//text is then drawn as quads out of it with no TTF work or texture creation
+class GlyphAtlas {
+  public:
+    GlyphAtlas() {};
+    ~GlyphAtlas() { free(); };
+
+    bool init(TTF_Font* font, const SDL_Color& color, const bool shadow = false);
+    void free();
+
+    //x, y is the upper left corner, '\n' starts a new line and characters
+    //missing from the atlas advance like a space
+    void render(const char* text, const int x, const int y) const;
+    int lineHeight() const { return line_height_; }
+  private:
+#define GLYPH_FIRST 32
+#define GLYPH_LAST 126
+    struct Glyph {
+      SDL_Rect src;
+      int advance;
+    };
+
+    SDL_Texture* texture_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    int line_height_ = 0;
+    Glyph glyphs_[GLYPH_LAST - GLYPH_FIRST + 1];
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    mutable std::vector<SDL_Vertex> vertices_;
+    mutable std::vector<int> indices_;
+#endif
+};
+
+#endif
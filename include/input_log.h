@@ -0,0 +1,47 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __INPUT_LOG_H__
+#define __INPUT_LOG_H__ 1
+
+#include <command.h>
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+//records the commands applied each tick, or feeds back a recorded session.
+//a seed, the agent count and the log are enough to replay a run exactly
+class InputLog {
+  public:
+    InputLog() {};
+    ~InputLog() { close(); };
+
+    //writes the scenario header to path, process() appends to it
+    bool record(const char* path, const uint64_t seed, const uint32_t n_agents);
+    //loads a log written by record(), seed() and agents() return its scenario
+    bool replay(const char* path);
+    void close();
+
+    bool isRecording() const { return out_.is_open(); }
+    bool isReplaying() const { return replaying_; }
+    uint64_t seed() const { return seed_; }
+    uint32_t agents() const { return n_agents_; }
+
+    //stamps the live commands with tick and records them, when replaying
+    //they are replaced by the logged commands of that tick
+    void process(const uint32_t tick, std::vector<Command>* commands);
+  private:
+    std::ofstream out_;
+    std::vector<Command> replay_;
+    uint32_t next_ = 0;
+    bool replaying_ = false;
+    uint64_t seed_ = 0;
+    uint32_t n_agents_ = 0;
+};
+
+#endif
@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __KINEMATIC_STORE_H__
+#define __KINEMATIC_STORE_H__ 1
+
+#include <defines.h>
+#include <mathlib/vec2.h>
+
+#include <cstdint>
+#include <vector>
+
+//structure of arrays holding the KinematicStatus of a set of bodies,
+//each field lives in its own contiguous array indexed by body
+class KinematicStore {
+  public:
+    KinematicStore() {};
+    ~KinematicStore() {};
+
+    //appends a new entry and returns its index
+    uint32_t add(const KinematicStatus& status = KinematicStatus());
+    //removes entry i moving the last entry into its slot
+    void remove(const uint32_t i);
+    void reserve(const uint32_t count);
+    void clear();
+    uint32_t size() const { return (uint32_t)pos_x_.size(); }
+
+    //gather / scatter a whole entry
+    KinematicStatus get(const uint32_t i) const;
+    void set(const uint32_t i, const KinematicStatus& status);
+
+    //FNV-1a over the bits of every field, chained from h
+    uint64_t hash(uint64_t h) const;
+
+    MathLib::Vec2 position(const uint32_t i) const { return MathLib::Vec2(pos_x_[i], pos_y_[i]); }
+    MathLib::Vec2 velocity(const uint32_t i) const { return MathLib::Vec2(vel_x_[i], vel_y_[i]); }
+
+    const float* posX() const { return pos_x_.data(); }
+    const float* posY() const { return pos_y_.data(); }
+    const float* velX() const { return vel_x_.data(); }
+    const float* velY() const { return vel_y_.data(); }
+    const float* orientation() const { return orientation_.data(); }
+    const float* rotation() const { return rotation_.data(); }
+    const float* speed() const { return speed_.data(); }
+    const float* wander() const { return wander_.data(); }
+
+    float* posX() { return pos_x_.data(); }
+    float* posY() { return pos_y_.data(); }
+    float* velX() { return vel_x_.data(); }
+    float* velY() { return vel_y_.data(); }
+    float* orientation() { return orientation_.data(); }
+    float* rotation() { return rotation_.data(); }
+    float* speed() { return speed_.data(); }
+    float* wander() { return wander_.data(); }
+  private:
+    std::vector<float> pos_x_;
+    std::vector<float> pos_y_;
+    std::vector<float> vel_x_;
+    std::vector<float> vel_y_;
+    std::vector<float> orientation_;
+    std::vector<float> rotation_;
+    std::vector<float> speed_;
+    std::vector<float> wander_;
+};
+
+//double buffered store: during an update every body reads the frozen front
+//and writes its new state into the back, swap() publishes the back
+class KinematicBuffer {
+  public:
+    KinematicBuffer() {};
+    ~KinematicBuffer() {};
+
+    uint32_t add(const KinematicStatus& status = KinematicStatus());
+    void remove(const uint32_t i);
+    void reserve(const uint32_t count);
+    void clear();
+    uint32_t size() const { return store_[0].size(); }
+
+    //writes an entry outside of an update, into both buffers
+    void set(const uint32_t i, const KinematicStatus& status);
+
+    const KinematicStore& front() const { return store_[front_]; }
+    KinematicStore& back() { return store_[front_ ^ 1]; }
+    //right after swap() the back buffer still holds the state before the update
+    const KinematicStore& previous() const { return store_[front_ ^ 1]; }
+    void swap() { front_ ^= 1; }
+  private:
+    KinematicStore store_[2];
+    uint32_t front_ = 0;
+};
+
+#endif
@@ -19,6 +19,45 @@ TODO Explore SSE4.2, AVX2, ....
 
 #include <cstdint>
 
+//select the implementation at build time, -DML_USE_SSE=1 (genie --sse)
+//needs SSE3 for _mm_hadd_ps, -msse3 on GCC/Clang
+#ifndef ML_USE_SSE
 #define ML_USE_SSE 0
+#endif
+
+//approximate normalize, atan2, sin/cos and angle wrap, see fast_math.h for
+//the error bounds. -DML_FAST_MATH=1 (genie --fast-math)
+#ifndef ML_FAST_MATH
+#define ML_FAST_MATH 0
+#endif
+
+#define ML_PI 3.14159265358979323846
+
+//vector members that only touch plain floats can be evaluated at compile
+//time, the intrinsics of the SSE path can not
+#if ML_USE_SSE
+#define ML_CONSTEXPR inline
+#else
+#define ML_CONSTEXPR constexpr
+#endif
+
+#if ML_USE_SSE
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace MathLib {
+  //component access into a __m128, m128_f32 only exists on MSVC
+#ifdef _MSC_VER
+  inline float& sseLane(__m128& v, const uint16_t i) { return v.m128_f32[i]; }
+  inline float sseLane(const __m128& v, const uint16_t i) { return v.m128_f32[i]; }
+#else
+  inline float& sseLane(__m128& v, const uint16_t i) { return reinterpret_cast<float*>(&v)[i]; }  //__m128 is may_alias
+  inline float sseLane(const __m128& v, const uint16_t i) { return reinterpret_cast<const float*>(&v)[i]; }
+#endif
+}
+#endif
 
 #endif
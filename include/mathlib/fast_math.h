@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2017                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __ML_FAST_MATH_H__
+#define __ML_FAST_MATH_H__ 1
+
+#include "defines.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace MathLib {
+
+  //approximations of the scalar functions the steering code leans on. the
+  //bounds are the worst case measured over the inputs listed (MathLib.Bench
+  //prints them), against the double precision result
+  namespace Fast {
+    const float kPi = 3.14159265f;
+    const float kHalfPi = 1.57079633f;
+    const float kTwoPi = 6.28318531f;
+    const float kInvTwoPi = 0.159154943f;
+
+    //the bounds quoted below, MathLib.Bench fails when a sweep goes over them
+    const double kRsqrtMaxRelError = 5e-6;
+    const double kAngleMaxAbsError = 3e-6;   //atan2, sincos and wrapAngle, |x| < 64
+
+    /** 1 / sqrt(x), x > 0. relative error < 5e-6 */
+    inline float rsqrt(const float x) {
+#if ML_USE_SSE
+      const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+      return y * (1.5f - (0.5f * x * y * y));
+#else
+      uint32_t i;
+      memcpy(&i, &x, sizeof(i));
+      i = 0x5f375a86 - (i >> 1);
+      float y;
+      memcpy(&y, &i, sizeof(y));
+      y = y * (1.5f - (0.5f * x * y * y));
+      return y * (1.5f - (0.5f * x * y * y));
+#endif
+    }
+
+    /** Wraps an angle into [-PI, PI] without branches, |x| < 1e9.
+    absolute error < 3e-6 for |x| < 64, it grows with the ulp of x */
+    inline float wrapAngle(const float x) {
+      const float t = (x + kPi) * kInvTwoPi;
+      float turns = (float)(int32_t)t;
+      turns -= (turns > t) ? 1.0f : 0.0f;       //floor, compiles to a compare and a select
+      return x - (turns * kTwoPi);
+    }
+
+    /** atan2(y, x) in [-PI, PI], 0 for (0, 0). absolute error < 3e-6 rad */
+    inline float atan2(const float y, const float x) {
+      const float ax = std::fabs(x);
+      const float ay = std::fabs(y);
+      const float hi = (ax > ay) ? ax : ay;
+      const float lo = (ax > ay) ? ay : ax;
+      const float a = lo / ((hi > 0.0f) ? hi : 1.0f);
+      const float s = a * a;
+      float r = (((((-0.0117212f * s + 0.05265332f) * s - 0.11643287f) * s + 0.19354346f) * s
+        - 0.33262347f) * s + 0.99997726f) * a;
+      r = (ay > ax) ? (kHalfPi - r) : r;
+      r = (x < 0.0f) ? (kPi - r) : r;
+      return (y < 0.0f) ? -r : r;
+    }
+
+    /** sin and cos of ang in one go, |ang| < 1e9.
+    absolute error < 3e-6 for |ang| < 64, it grows with the ulp of ang */
+    inline void sincos(const float ang, float* s, float* c) {
+      //reduce to r in [-PI/4, PI/4] and the quarter turn it sits in, PI/2 is
+      //split in two floats so the reduction keeps its precision
+      const int32_t quadrant = (int32_t)((ang * 0.636619772f) + ((ang < 0.0f) ? -0.5f : 0.5f));
+      const float q = (float)quadrant;
+      const float r = (ang - (q * 1.57079637f)) + (q * 4.37113883e-8f);
+      const float r2 = r * r;
+      const float rs = r * (1.0f + r2 * (-1.6666667e-1f + r2 * (8.3333333e-3f + r2 * (-1.9841270e-4f
+        + r2 * 2.7557319e-6f))));
+      const float rc = 1.0f + r2 * (-0.5f + r2 * (4.1666667e-2f + r2 * (-1.3888889e-3f
+        + r2 * 2.4801587e-5f)));
+      //odd quarter turns swap sin and cos, the sign follows the quadrant
+      const float sq = (quadrant & 1) ? rc : rs;
+      const float cq = (quadrant & 1) ? rs : rc;
+      *s = (quadrant & 2) ? -sq : sq;
+      *c = ((quadrant + 1) & 2) ? -cq : cq;
+    }
+  }
+
+  //the functions the simulation calls, precise unless the build opts in
+  //with ML_FAST_MATH (genie --fast-math). Vec2::normalized and fromPolar
+  //switch to the Fast versions the same way
+
+  inline float atan2(const float y, const float x) {
+#if ML_FAST_MATH
+    return Fast::atan2(y, x);
+#else
+    return (float)std::atan2((double)y, (double)x);
+#endif
+  }
+
+  /** Wraps an angle into [-PI, PI) */
+  inline float wrapAngle(const double x) {
+#if ML_FAST_MATH
+    return Fast::wrapAngle((float)x);
+#else
+    double w = fmod(x + ML_PI, ML_PI * 2.0);
+    if (w < 0) w += ML_PI * 2.0;
+    return (float)(w - ML_PI);
+#endif
+  }
+}
+
+#endif
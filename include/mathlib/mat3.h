@@ -13,14 +13,6 @@
 
 #include <iostream>
 
-#if ML_USE_SSE
-#ifdef _MSC_VER
-#include <intrin.h>
-#else
-#include <x86intrin.h>      //TODO Untested SSE outside MSCV
-#endif  
-#endif
-
 namespace MathLib {
 
   class Mat3 {
@@ -9,16 +9,12 @@
 #define __ML_VEC2_H__ 1
 
 #include "defines.h"
+#include "fast_math.h"
 
+#include <cassert>
+#include <cmath>
 #include <iostream>
-
-#if ML_USE_SSE
-#ifdef _MSC_VER
-#include <intrin.h>
-#else
-#include <x86intrin.h>      //TODO Untested SSE outside MSCV
-#endif  
-#endif
+#include <type_traits>
 
 namespace MathLib {
 
@@ -37,16 +33,12 @@ namespace MathLib {
       };
 
       /** Default constructor. Sets to zeros */
-      Vec2();
-
-      /** Copy constructor
-      @param o Vector to copy from */
-      Vec2(const Vec2&o);
+      ML_CONSTEXPR Vec2();
 
       /** Constructor using a pair of float values
       @param u1 The first vector component
       @param u2 The second vector component*/
-      Vec2(const float u1, const float u2);
+      ML_CONSTEXPR Vec2(const float u1, const float u2);
 
       /** Constructor using a __m128
       @param o __128 to create */
@@ -54,15 +46,12 @@ namespace MathLib {
       Vec2(const __m128 o);
 #endif
 
-      /** Destructor */
-      ~Vec2();
-
       /** Returns the first component */
-      const float x() const;
-      float& x();
+      ML_CONSTEXPR const float x() const;
+      ML_CONSTEXPR float& x();
       /** Returns the second component */
-      const float y() const;
-      float& y();      
+      ML_CONSTEXPR const float y() const;
+      ML_CONSTEXPR float& y();      
 
       /** Returns the __m128 */
 #if ML_USE_SSE   
@@ -74,78 +63,77 @@ namespace MathLib {
       /** Subscript operators */
       /** @param index You can use one of the enums defined for vec2
       * X,Y,R,G,U,V*/
-      const float operator[](uint16_t index) const;  // subscript without modifying
-      float& operator[](uint16_t index);  // Subscript modifying
-
-      /** Assignment operator
-      @param o Vector to copy from */
-      Vec2& operator=(const Vec2& o);
+      ML_CONSTEXPR const float operator[](uint16_t index) const;  // subscript without modifying
+      ML_CONSTEXPR float& operator[](uint16_t index);  // Subscript modifying
 
       /** Unary minus (-x,-y) */
-      const Vec2 operator-() const;
+      ML_CONSTEXPR const Vec2 operator-() const;
 
       /** Internal addition operator */
-      Vec2& operator+=(const Vec2& o);
+      ML_CONSTEXPR Vec2& operator+=(const Vec2& o);
       /** Internal substraction operator */
-      Vec2& operator-=(const Vec2& o);
+      ML_CONSTEXPR Vec2& operator-=(const Vec2& o);
       /** Internal scalar multiplication */
-      Vec2& operator*=(const float o);
+      ML_CONSTEXPR Vec2& operator*=(const float o);
       /** Internal scalar division */
-      Vec2& operator/=(const float o);
+      ML_CONSTEXPR Vec2& operator/=(const float o);
 
       /** External addition */
-      const Vec2 operator+(const Vec2& o) const;
+      ML_CONSTEXPR const Vec2 operator+(const Vec2& o) const;
       /** External substraction */
-      const Vec2 operator-(const Vec2& o) const;
+      ML_CONSTEXPR const Vec2 operator-(const Vec2& o) const;
       /** External scalar multiplication */
-      const Vec2 operator*(const float o) const;
+      ML_CONSTEXPR const Vec2 operator*(const float o) const;
       /** External scalar division */
-      const Vec2 operator/(const float o) const;
+      ML_CONSTEXPR const Vec2 operator/(const float o) const;
 
       /** Dot product */
-      float operator*(const Vec2& o) const;
+      ML_CONSTEXPR float operator*(const Vec2& o) const;
 
       /** Equal operator */
-      inline const bool operator==(Vec2 &o);
+      ML_CONSTEXPR const bool operator==(const Vec2& o) const;
       /** Non-Equal operator */
-      inline const bool operator!=(Vec2 &o);
+      ML_CONSTEXPR const bool operator!=(const Vec2& o) const;
 
       /* Named methods */
       /** Internal addition */
-      Vec2& addEq(const Vec2& o);
+      ML_CONSTEXPR Vec2& addEq(const Vec2& o);
       /** Internal substraction */
-      Vec2& subEq(const Vec2& o);
+      ML_CONSTEXPR Vec2& subEq(const Vec2& o);
       /** Internal scalar mutiplication */
-      Vec2& multEq(const float o);
+      ML_CONSTEXPR Vec2& multEq(const float o);
       /** Internal scalar division */
-      Vec2& divEq(const float o);
+      ML_CONSTEXPR Vec2& divEq(const float o);
       /** External addition */
-      const Vec2 add(const Vec2& o) const;
+      ML_CONSTEXPR const Vec2 add(const Vec2& o) const;
       /** External substraction */
-      const Vec2 sub(const Vec2& o) const;
+      ML_CONSTEXPR const Vec2 sub(const Vec2& o) const;
       /** External scalar multiplication */
-      const Vec2 mult(const float o) const;
+      ML_CONSTEXPR const Vec2 mult(const float o) const;
       /** External scalar division */
-      const Vec2 div(const float o) const;
+      ML_CONSTEXPR const Vec2 div(const float o) const;
 
       /* Vector operations */
       /** Dot product */
-      float dot(const Vec2& o) const;
+      ML_CONSTEXPR float dot(const Vec2& o) const;
 
       /** Returns length of the current vector */
       float length() const;
       /** Returns squared length of the current vector*/
-      float length2() const;
+      ML_CONSTEXPR float length2() const;
+      /** True when the vector is shorter than radius, compares squared
+      lengths so no square root is taken */
+      ML_CONSTEXPR bool withinRadius(const float radius) const;
       /** Returns the vector normalized */
       const Vec2 normalized() const;
       /** Returns a tangent vector (-y,x) */
-      const Vec2 tangent() const;
+      ML_CONSTEXPR const Vec2 tangent() const;
       /** Truncate by a scalar */
       const Vec2 trunc(const float o) const;
 
       /* Additional */
       /** Set Vector to Zeros **/
-      void zeros();
+      ML_CONSTEXPR void zeros();
 
       /** Conversion to Polar (degrees) **/
       void toPolar(float &dist, float &ang, const bool use_rads = true) const;
@@ -157,11 +145,242 @@ namespace MathLib {
       __m128 vec_;
 #else
       alignas(alignof(float)) float vec_[2];
-      static uint32_t vec_size_;
 #endif
   };
 
+  static_assert(std::is_trivially_copyable<Vec2>::value, "Vec2 must stay trivially copyable");
+
   /** Output stream for vec2 */
   std::ostream& operator<<(std::ostream& left, const Vec2& v);
+
+//Implementation, inlined so the vector math stays in registers
+#if ML_USE_SSE
+
+#include "vec2_sse.h"
+
+#else
+#pragma region Constructors
+  ML_CONSTEXPR Vec2::Vec2() : vec_{ 0.0f, 0.0f } {}
+
+  ML_CONSTEXPR Vec2::Vec2(const float u1, const float u2) : vec_{ u1, u2 } {}
+#pragma endregion
+
+#pragma region Components
+  ML_CONSTEXPR const float Vec2::x() const {
+    return vec_[X];
+  }
+
+  ML_CONSTEXPR float& Vec2::x() {
+    return vec_[X];
+  }
+
+  ML_CONSTEXPR const float Vec2::y() const {
+    return vec_[Y];
+  }
+
+  ML_CONSTEXPR float& Vec2::y() {
+    return vec_[Y];
+  }
+#pragma endregion
+
+#pragma region Operators
+  ML_CONSTEXPR const float Vec2::operator[](uint16_t index) const {  // subscript without modifying
+    assert(index<2);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR float& Vec2::operator[](uint16_t index) {  // Subscript modifying
+    assert(index<2);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::operator-() const {
+    return Vec2(-vec_[X], -vec_[Y]);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR Vec2& Vec2::addEq(const Vec2& o) {
+    vec_[X] += o.x();
+    vec_[Y] += o.y();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::subEq(const Vec2& o) {
+    vec_[X] -= o.x();
+    vec_[Y] -= o.y();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::multEq(const float o) {
+    vec_[X] *= o;
+    vec_[Y] *= o;
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::divEq(const float o) {
+    assert(o != 0.0f);
+    vec_[X] /= o;
+    vec_[Y] /= o;
+    return *this;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec2::dot(const Vec2& o) const {
+    return (vec_[X] * o.x()) + (vec_[Y] * o.y());
+  }
+
+  inline float Vec2::length() const {
+    return (float)sqrt((double)dot(*this));
+  }
+
+  inline const Vec2 Vec2::normalized() const {
+#if ML_FAST_MATH
+    const float module2 = length2();
+    assert(module2 != 0);
+    const float inv = Fast::rsqrt(module2);
+    return Vec2(vec_[X] * inv, vec_[Y] * inv);
+#else
+    float module = length();
+    assert(module != 0);
+    return Vec2(vec_[X] / module, vec_[Y] / module);
+#endif
+  }
+#pragma endregion
+
+#pragma region Additional
+  ML_CONSTEXPR void Vec2::zeros() {
+    vec_[X] = 0.0f;
+    vec_[Y] = 0.0f;
+  }
+
+  inline void Vec2::fromPolar(const float dist, const float ang, const bool use_rads) {
+    float rad = ang;
+    if (!use_rads) {
+      rad *= (float)(ML_PI / 180);
+    }
+#if ML_FAST_MATH
+    float s, c;
+    Fast::sincos(rad, &s, &c);
+    vec_[0] = dist*c;
+    vec_[1] = dist*s;
+#else
+    vec_[0] = dist*cos(rad);
+    vec_[1] = dist*sin(rad);
+#endif
+  }
+#pragma endregion
+#endif
+
+//Common Implementations
+
+#pragma region Operators
+  ML_CONSTEXPR Vec2& Vec2::operator+=(const Vec2& o) {
+    return addEq(o);
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::operator-=(const Vec2& o) {
+    return subEq(o);
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::operator*=(const float o) {
+    return multEq(o);
+  }
+
+  ML_CONSTEXPR Vec2& Vec2::operator/=(const float o) {
+    assert(o != 0);
+    return divEq(o);
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::operator+(const Vec2& o) const {
+    return add(o);
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::operator-(const Vec2& o) const {
+    return sub(o);
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::operator*(const float o) const {
+    return mult(o);
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::operator/(const float o) const {
+    assert(o != 0);
+    return div(o);
+  }
+
+  ML_CONSTEXPR float Vec2::operator*(const Vec2& o) const {
+    return dot(o);
+  }
+
+  ML_CONSTEXPR const bool Vec2::operator==(const Vec2& o) const {
+    return (x() == o.x()) && (y() == o.y());
+  }
+
+  ML_CONSTEXPR const bool Vec2::operator!=(const Vec2& o) const {
+    return !(*this == o);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR const Vec2 Vec2::add(const Vec2& o) const {
+    Vec2 result = *this;
+    result.addEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::sub(const Vec2& o) const {
+    Vec2 result = *this;
+    result.subEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::mult(const float o) const {
+    Vec2 result = *this;
+    result.multEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::div(const float o) const {
+    assert(o != 0.0f);
+    Vec2 result = *this;
+    result.divEq(o);
+    return result;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec2::length2() const {
+    return dot(*this);
+  }
+
+  ML_CONSTEXPR bool Vec2::withinRadius(const float radius) const {
+    return length2() < (radius * radius);
+  }
+
+  ML_CONSTEXPR const Vec2 Vec2::tangent() const {
+    return Vec2(-y(), x());
+  }
+
+  inline const Vec2 Vec2::trunc(const float o) const {
+    float l = length();
+    if (l > o) {
+      return normalized() * o;
+    } else {
+      return *this;
+    }
+  }
+#pragma endregion
+
+#pragma region Additional
+  inline void Vec2::toPolar(float &dist, float &ang, const bool use_rads) const {
+    dist = length();
+    ang = atan(y() / x());
+    if (!use_rads) {
+      ang *= (float)(180 / ML_PI);
+    }
+  }
+#pragma endregion
 }
 #endif
\ No newline at end of file
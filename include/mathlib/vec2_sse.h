@@ -6,90 +6,79 @@
 //----------------------------------------------------------------------------
 
 #pragma region Constructors
-  Vec2::Vec2() {
+  inline Vec2::Vec2() {
     vec_ = _mm_setzero_ps();
   }
 
-  Vec2::Vec2(const Vec2& o) {
-    vec_ = o.vec_;
-  }
-
-  Vec2::Vec2(const float u1, const float u2) {
+  inline Vec2::Vec2(const float u1, const float u2) {
     vec_ = _mm_set_ps(0, 0, u2, u1);          //high to low MSB u4|u3|u2|u1 LSB
   }
 
-  Vec2::Vec2(const __m128 o) {
+  inline Vec2::Vec2(const __m128 o) {
     vec_ = o;
   }
 #pragma endregion
 
 #pragma region Components
-  const float Vec2::x() const {
-    return vec_.m128_f32[X];
+  inline const float Vec2::x() const {
+    return sseLane(vec_, X);
   }
 
-  float& Vec2::x() {
-    return vec_.m128_f32[X];
+  inline float& Vec2::x() {
+    return sseLane(vec_, X);
   }
 
-  const float Vec2::y() const {
-    return vec_.m128_f32[Y];
+  inline const float Vec2::y() const {
+    return sseLane(vec_, Y);
   }
 
-  float& Vec2::y() {
-    return vec_.m128_f32[Y];
+  inline float& Vec2::y() {
+    return sseLane(vec_, Y);
   }
 
-  const __m128 Vec2::sse_val() const {
+  inline const __m128 Vec2::sse_val() const {
     return vec_;
   }
 
-  __m128& Vec2::sse_val() {
+  inline __m128& Vec2::sse_val() {
     return vec_;
   }
 #pragma endregion
 
 #pragma region Operators
-  Vec2& Vec2::operator=(const Vec2& o) {
-    if (this != &o) {
-      vec_ = o.vec_;
-    }
-    return *this;
-  }
-
-  const float Vec2::operator[](uint16_t index) const {  
+  inline const float Vec2::operator[](uint16_t index) const {  
     assert(index < 2);
-    return vec_.m128_f32[index];
+    return sseLane(vec_, index);
   }
 
-  float& Vec2::operator[](uint16_t index) {  
+  inline float& Vec2::operator[](uint16_t index) {  
     assert(index < 2);
-    return vec_.m128_f32[index];
+    return sseLane(vec_, index);
   }
 
-  const Vec2 Vec2::operator-() const {
-    return Vec2(-vec_.m128_f32[X], -vec_.m128_f32[Y]);
+  inline const Vec2 Vec2::operator-() const {
+    return Vec2(-sseLane(vec_, X), -sseLane(vec_, Y));
   }
 #pragma endregion
 
 #pragma region Named Operators
-  Vec2& Vec2::addEq(const Vec2& o) {
+  inline Vec2& Vec2::addEq(const Vec2& o) {
     vec_ = _mm_add_ps(vec_, o.vec_);
     return *this;
   }
 
-  Vec2& Vec2::subEq(const Vec2& o) {
+  inline Vec2& Vec2::subEq(const Vec2& o) {
     vec_ = _mm_sub_ps(vec_, o.vec_);
     return *this;
   }
 
-  Vec2& Vec2::multEq(const float o) {
+  inline Vec2& Vec2::multEq(const float o) {
     __m128 aux = _mm_set1_ps(o);
     vec_ = _mm_mul_ps(vec_, aux);
     return *this;
   }
 
-  Vec2& Vec2::divEq(const float o) {
+  inline Vec2& Vec2::divEq(const float o) {
     assert(o != 0.0f);
     __m128 aux = _mm_set1_ps(o);
     vec_ = _mm_div_ps(vec_, aux);
@@ -98,7 +87,7 @@
 #pragma endregion
 
 #pragma region Vector Ops
-  float Vec2::dot(const Vec2& o) const {
+  inline float Vec2::dot(const Vec2& o) const {
     __m128 aux = _mm_mul_ps(vec_, o.vec_);
     aux = _mm_hadd_ps(aux, aux);
     float res;
@@ -106,31 +95,43 @@
     return res;
   }
 
-  float Vec2::length() const {
+  inline float Vec2::length() const {
     __m128 aux = _mm_mul_ps(vec_, vec_);
     float res;
     _mm_store_ss(&res, _mm_sqrt_ps(_mm_hadd_ps(aux, aux)));
     return res;
   }
 
-  const Vec2 Vec2::normalized() const {
+  inline const Vec2 Vec2::normalized() const {
     __m128 aux = _mm_mul_ps(vec_, vec_);          
     aux = _mm_hadd_ps(aux, aux);
+#if ML_FAST_MATH
+    const __m128 inv = _mm_set1_ps(Fast::rsqrt(_mm_cvtss_f32(_mm_hadd_ps(aux, aux))));
+    return Vec2(_mm_mul_ps(vec_, inv));
+#else
     return Vec2(_mm_div_ps(vec_, _mm_sqrt_ps(_mm_hadd_ps(aux, aux))));
+#endif
   }
 #pragma endregion
 
 #pragma region Additional
-  void Vec2::zeros() {
+  inline void Vec2::zeros() {
     vec_ = _mm_setzero_ps();
   }
 
-  void Vec2::fromPolar(const float dist, const float ang, const bool use_rads) {
+  inline void Vec2::fromPolar(const float dist, const float ang, const bool use_rads) {
     float rad = ang;
     if (!use_rads) {
-      rad *= (float)(M_PI / 180);
+      rad *= (float)(ML_PI / 180);
     }
-    vec_.m128_f32[0] = dist*cos(rad);
-    vec_.m128_f32[1] = dist*sin(rad);
+#if ML_FAST_MATH
+    float s, c;
+    Fast::sincos(rad, &s, &c);
+    sseLane(vec_, 0) = dist*c;
+    sseLane(vec_, 1) = dist*s;
+#else
+    sseLane(vec_, 0) = dist*cos(rad);
+    sseLane(vec_, 1) = dist*sin(rad);
+#endif
   }
 #pragma endregion
\ No newline at end of file
@@ -10,15 +10,10 @@
 
 #include "defines.h"
 
+#include <cassert>
+#include <cmath>
 #include <iostream>
-
-#if ML_USE_SSE
-#ifdef _MSC_VER
-#include <intrin.h>
-#else
-#include <x86intrin.h>      //TODO Untested SSE outside MSCV
-#endif  
-#endif
+#include <type_traits>
 
 namespace MathLib {
 
@@ -40,18 +35,14 @@ namespace MathLib {
       };
 
       /** Default constructor. Sets to zeros */
-      Vec3();
-
-      /** Copy constructor
-      @param o Vector to copy from */
-      Vec3(const Vec3& o);
+      ML_CONSTEXPR Vec3();
 
       /** Constructor using three float values
       @param u1 The first vector component
       @param u2 The second vector component
       @param u3 The third vector component
       */
-      Vec3(const float u1, const float u2, const float u3);
+      ML_CONSTEXPR Vec3(const float u1, const float u2, const float u3);
 
       /** Constructor using a __m128
       @param o __128 to create */
@@ -59,29 +50,22 @@ namespace MathLib {
       Vec3(const __m128 o);
 #endif
 
-      /** Destructor */
-      ~Vec3();
-
-      /** Assignment operator
-      @param o Vector to copy from */
-      Vec3& operator=(const Vec3& o);
-
       /** Subscript operators */
       /** You can use one of the enums defined for vec3
       * X,Y,Z,R,G,B,U,V,S
       */
-      const float operator[](unsigned short index) const;
-      float& operator[](unsigned short index);
+      ML_CONSTEXPR const float operator[](unsigned short index) const;
+      ML_CONSTEXPR float& operator[](unsigned short index);
 
       /** Returns the first component */
-      const float x() const;
-      float& x();
+      ML_CONSTEXPR const float x() const;
+      ML_CONSTEXPR float& x();
       /** Returns the second component */
-      const float y() const;
-      float& y();
+      ML_CONSTEXPR const float y() const;
+      ML_CONSTEXPR float& y();
       /** Returns the third component */
-      const float z() const;
-      float& z();
+      ML_CONSTEXPR const float z() const;
+      ML_CONSTEXPR float& z();
       /** Returns the __m128 */
 #if ML_USE_SSE    //SSE enabled
       const __m128 sse_val() const;
@@ -89,79 +73,281 @@ namespace MathLib {
 #endif
 
       /** Unary minus (-x,-y, -z) */
-      const Vec3 operator-() const;
+      ML_CONSTEXPR const Vec3 operator-() const;
 
       /** Internal addition operator */
-      Vec3& operator+=(const Vec3& o);
+      ML_CONSTEXPR Vec3& operator+=(const Vec3& o);
       /** Internal substraction operator */
-      Vec3& operator-=(const Vec3& o);
+      ML_CONSTEXPR Vec3& operator-=(const Vec3& o);
       /** Internal scalar multiplication */
-      Vec3& operator*=(float o);
+      ML_CONSTEXPR Vec3& operator*=(float o);
       /** Internal scalar division */
-      Vec3& operator/=(float o);
+      ML_CONSTEXPR Vec3& operator/=(float o);
 
       /** External addition */
-      const Vec3 operator+(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 operator+(const Vec3& o) const;
       /** External substraction */
-      const Vec3 operator-(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 operator-(const Vec3& o) const;
       /** Cross product (tangent) */
-      const Vec3 operator^(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 operator^(const Vec3& o) const;
       /** External scalar multiplication */
-      const Vec3 operator*(float o) const;
+      ML_CONSTEXPR const Vec3 operator*(float o) const;
       /** External scalar division */
-      const Vec3 operator/(float o) const;
+      ML_CONSTEXPR const Vec3 operator/(float o) const;
 
       /** Dot product */
-      float operator*(const Vec3& o) const;
+      ML_CONSTEXPR float operator*(const Vec3& o) const;
 
       /** Equal operator */
-      inline const bool operator==(Vec3 &o);
+      ML_CONSTEXPR const bool operator==(const Vec3& o) const;
       /** Non-Equal operator */
-      inline const bool operator!=(Vec3 &o);
+      ML_CONSTEXPR const bool operator!=(const Vec3& o) const;
 
       /** Returns length of the current vector */
       float length() const;
       /** Returns squared length of the current vector*/
-      float length2() const;
+      ML_CONSTEXPR float length2() const;
       /** Returns the vector normalized */
       const Vec3 normalized() const;
       /** Returns a tangent vector (cross product) */
-      const Vec3 cross(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 cross(const Vec3& o) const;
 
       /* Named methods */
       /** Internal addition */
-      Vec3& addEq(const Vec3& o);
+      ML_CONSTEXPR Vec3& addEq(const Vec3& o);
       /** Internal substraction */
-      Vec3& subEq(const Vec3& o);
+      ML_CONSTEXPR Vec3& subEq(const Vec3& o);
       /** Internal scalar mutiplication */
-      Vec3& multEq(const float o);
+      ML_CONSTEXPR Vec3& multEq(const float o);
       /** Internal scalar division */
-      Vec3& divEq(const float o);
+      ML_CONSTEXPR Vec3& divEq(const float o);
       /** External addition */
-      const Vec3 add(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 add(const Vec3& o) const;
       /** External substraction */
-      const Vec3 sub(const Vec3& o) const;
+      ML_CONSTEXPR const Vec3 sub(const Vec3& o) const;
       /** External scalar multiplication */
-      const Vec3 mult(const float o) const;
+      ML_CONSTEXPR const Vec3 mult(const float o) const;
       /** External scalar division */
-      const Vec3 div(const float o) const;
+      ML_CONSTEXPR const Vec3 div(const float o) const;
       /** Dot product */
-      float dot(const Vec3& o) const;
+      ML_CONSTEXPR float dot(const Vec3& o) const;
 
       /* ADDITIONAL METHODS */
       /** Set Vector to Zeros **/
-      void zeros();
+      ML_CONSTEXPR void zeros();
     private:
 #if ML_USE_SSE
       __m128 vec_;
 #else  
       alignas(alignof(float)) float vec_[3];
-      static uint32_t vec_size_;
 #endif
   };
 
+  static_assert(std::is_trivially_copyable<Vec3>::value, "Vec3 must stay trivially copyable");
+
   /** Output stream for vec3 */
   std::ostream& operator<<(std::ostream& left, const Vec3& v);
 
+//Implementation, inlined so the vector math stays in registers
+#if ML_USE_SSE
+
+#include "vec3_sse.h"
+
+#else
+#pragma region Constructors
+  ML_CONSTEXPR Vec3::Vec3() : vec_{ 0.0f, 0.0f, 0.0f } {}
+
+  ML_CONSTEXPR Vec3::Vec3(const float u1, const float u2, const float u3) : vec_{ u1, u2, u3 } {}
+#pragma endregion
+
+#pragma region Components
+  ML_CONSTEXPR const float Vec3::x() const {
+    return vec_[X]; 
+  }
+
+  ML_CONSTEXPR float& Vec3::x() {
+    return vec_[X];
+  }
+
+  ML_CONSTEXPR const float Vec3::y() const {
+    return vec_[Y];
+  }
+
+  ML_CONSTEXPR float& Vec3::y() {
+    return vec_[Y];
+  }
+
+  ML_CONSTEXPR const float Vec3::z() const {
+    return vec_[Z];
+  }
+
+  ML_CONSTEXPR float& Vec3::z() {
+    return vec_[Z];
+  }
+#pragma endregion
+
+#pragma region Operators
+  ML_CONSTEXPR const float Vec3::operator[](unsigned short index) const { 
+    assert(index<3);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR float& Vec3::operator[](unsigned short index) {
+    assert(index<3);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator-() const {
+    return Vec3(-vec_[X], -vec_[Y], -vec_[Z]);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR Vec3& Vec3::addEq(const Vec3& o) {
+    vec_[X] += o.x();
+    vec_[Y] += o.y();
+    vec_[Z] += o.z();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::subEq(const Vec3& o) {
+    vec_[X] -= o.x();
+    vec_[Y] -= o.y();
+    vec_[Z] -= o.z();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::multEq(const float o) {
+    vec_[X] *= o;
+    vec_[Y] *= o;
+    vec_[Z] *= o;
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::divEq(const float o) {
+    assert(o != 0.0f);
+    vec_[X] /= o;
+    vec_[Y] /= o;
+    vec_[Z] /= o;
+    return *this;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec3::dot(const Vec3& o) const {
+    return (vec_[X] * o.x()) + (vec_[Y] * o.y()) + (vec_[Z] * o.z());
+  }
+
+  inline float Vec3::length() const {
+    return (float)sqrt((double)dot(*this));
+  }
+
+  inline const Vec3 Vec3::normalized() const {
+    float module = length();
+    assert(module != 0);
+    return Vec3(vec_[X] / module, vec_[Y] / module, vec_[Z] / module);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::cross(const Vec3& o) const {
+    return Vec3(vec_[Y] * o.z() - vec_[Z] * o.y(), vec_[Z] * o.x() - vec_[X] * o.z(), vec_[X] * o.y() - vec_[Y] * o.x());
+  }
+#pragma endregion
+
+#pragma region Additional
+  ML_CONSTEXPR void Vec3::zeros() {
+    vec_[X] = 0.0f;
+    vec_[Y] = 0.0f;
+    vec_[Z] = 0.0f;
+  }
+#pragma endregion
+#endif
+
+//Common Implementations
+
+#pragma region Operators
+  ML_CONSTEXPR Vec3& Vec3::operator+=(const Vec3& o) {
+    return addEq(o);
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::operator-=(const Vec3& o) {
+    return subEq(o);
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::operator*=(const float o) {
+    return multEq(o);
+  }
+
+  ML_CONSTEXPR Vec3& Vec3::operator/=(const float o) {
+    assert(o != 0);
+    return divEq(o);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator+(const Vec3& o) const {
+    return add(o);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator-(const Vec3& o) const {
+    return sub(o);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator^(const Vec3& o) const {
+    return cross(o);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator*(const float o) const {
+    return mult(o);
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::operator/(const float o) const {
+    assert(o != 0);
+    return div(o);
+  }
+
+  ML_CONSTEXPR float Vec3::operator*(const Vec3& o) const {
+    return dot(o);
+  }
+
+  ML_CONSTEXPR const bool Vec3::operator==(const Vec3& o) const {
+    return (x() == o.x()) && (y() == o.y()) && (z() == o.z());
+  }
+
+  ML_CONSTEXPR const bool Vec3::operator!=(const Vec3& o) const {
+    return !(*this == o);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR const Vec3 Vec3::add(const Vec3& o) const {
+    Vec3 result = *this;
+    result.addEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::sub(const Vec3& o) const {
+    Vec3 result = *this;
+    result.subEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::mult(const float o) const {
+    Vec3 result = *this;
+    result.multEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec3 Vec3::div(const float o) const {
+    assert(o != 0.0f);
+    Vec3 result = *this;
+    result.divEq(o);
+    return result;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec3::length2() const {
+    return dot(*this);
+  }
+#pragma endregion
+
 }
 #endif
\ No newline at end of file
@@ -11,15 +11,10 @@
 #include "defines.h"
 #include "vec3.h"
 
+#include <cassert>
+#include <cmath>
 #include <iostream>
-
-#if ML_USE_SSE
-#ifdef _MSC_VER
-#include <intrin.h>
-#else
-#include <x86intrin.h>      //TODO Untested SSE outside MSCV
-#endif  
-#endif
+#include <type_traits>
 
 namespace MathLib {
 
@@ -44,17 +39,13 @@ namespace MathLib {
       };
 
       /** Default constructor. Sets to zeros */
-      Vec4();
-
-      /** Copy constructor
-      @param o Vector to copy from */
-      Vec4(const Vec4& o);
+      ML_CONSTEXPR Vec4();
 
       /** Constructor from a vec3 and a float
       @param o A vec3
       @param u4 The fourth vector component
       */
-      Vec4(const Vec3& o, const float u4);
+      ML_CONSTEXPR Vec4(const Vec3& o, const float u4);
 
       /** Constructor using three float values
       @param u1 The first vector component
@@ -62,7 +53,7 @@ namespace MathLib {
       @param u3 The third vector component
       @param u4 The fourth vector component
       */
-      Vec4(const float u1, const float u2, const float u3, const float u4);
+      ML_CONSTEXPR Vec4(const float u1, const float u2, const float u3, const float u4);
 
       /** Constructor using a __m128
       @param o __128 to create */
@@ -70,32 +61,25 @@ namespace MathLib {
       Vec4(const __m128 o);
   #endif
       
-      /** Destructor */
-      ~Vec4();
-
-      /** Assignment operator
-      @param o Vector to copy from */
-      Vec4& operator=(const Vec4& o);
-
       /** Subscript operators */
       /** You can use one of the enums defined for vec3
       * X,Y,Z,R,G,B,U,V,S
       */
-      const float operator[](unsigned short index) const;
-      float& operator[](unsigned short index);
+      ML_CONSTEXPR const float operator[](unsigned short index) const;
+      ML_CONSTEXPR float& operator[](unsigned short index);
 
       /** Returns the first component */
-      const float x() const;
-      float& x();
+      ML_CONSTEXPR const float x() const;
+      ML_CONSTEXPR float& x();
       /** Returns the second component */
-      const float y() const;
-      float& y();
+      ML_CONSTEXPR const float y() const;
+      ML_CONSTEXPR float& y();
       /** Returns the third component */
-      const float z() const;
-      float& z();
+      ML_CONSTEXPR const float z() const;
+      ML_CONSTEXPR float& z();
       /** Returns the fourth component */
-      const float w() const;
-      float& w();
+      ML_CONSTEXPR const float w() const;
+      ML_CONSTEXPR float& w();
 
       /** Returns the __m128 */
   #if ML_USE_SSE    //SSE enabled
@@ -104,75 +88,283 @@ namespace MathLib {
   #endif
 
       /** Unary minus (-x,-y, -z) */
-      const Vec4 operator-() const;
+      ML_CONSTEXPR const Vec4 operator-() const;
 
       /** Internal addition operator */
-      Vec4& operator+=(const Vec4& o);
+      ML_CONSTEXPR Vec4& operator+=(const Vec4& o);
       /** Internal substraction operator */
-      Vec4& operator-=(const Vec4& o);
+      ML_CONSTEXPR Vec4& operator-=(const Vec4& o);
       /** Internal scalar multiplication */
-      Vec4& operator*=(float o);
+      ML_CONSTEXPR Vec4& operator*=(float o);
       /** Internal scalar division */
-      Vec4& operator/=(float o);
+      ML_CONSTEXPR Vec4& operator/=(float o);
 
       /** External addition */
-      const Vec4 operator+(const Vec4& o) const;
+      ML_CONSTEXPR const Vec4 operator+(const Vec4& o) const;
       /** External substraction */
-      const Vec4 operator-(const Vec4& o) const;
+      ML_CONSTEXPR const Vec4 operator-(const Vec4& o) const;
       /** External scalar multiplication */
-      const Vec4 operator*(float o) const;
+      ML_CONSTEXPR const Vec4 operator*(float o) const;
       /** External scalar division */
-      const Vec4 operator/(float o) const;
+      ML_CONSTEXPR const Vec4 operator/(float o) const;
 
       /** Dot product */
-      float operator*(const Vec4& o) const;
+      ML_CONSTEXPR float operator*(const Vec4& o) const;
 
       /** Equal operator */
-      inline const bool operator==(Vec4 &o);
+      ML_CONSTEXPR const bool operator==(const Vec4& o) const;
       /** Non-Equal operator */
-      inline const bool operator!=(Vec4 &o);
+      ML_CONSTEXPR const bool operator!=(const Vec4& o) const;
 
       /** Returns length of the current vector */
       float length() const;
       /** Returns squared length of the current vector*/
-      float length2() const;
+      ML_CONSTEXPR float length2() const;
       /** Returns the vector normalized */
       const Vec4 normalized() const;
 
       /* Named methods */
       /** Internal addition */
-      Vec4& addEq(const Vec4& o);
+      ML_CONSTEXPR Vec4& addEq(const Vec4& o);
       /** Internal substraction */
-      Vec4& subEq(const Vec4& o);
+      ML_CONSTEXPR Vec4& subEq(const Vec4& o);
       /** Internal scalar mutiplication */
-      Vec4& multEq(const float o);
+      ML_CONSTEXPR Vec4& multEq(const float o);
       /** Internal scalar division */
-      Vec4& divEq(const float o);
+      ML_CONSTEXPR Vec4& divEq(const float o);
       /** External addition */
-      const Vec4 add(const Vec4& o) const;
+      ML_CONSTEXPR const Vec4 add(const Vec4& o) const;
       /** External substraction */
-      const Vec4 sub(const Vec4& o) const;
+      ML_CONSTEXPR const Vec4 sub(const Vec4& o) const;
       /** External scalar multiplication */
-      const Vec4 mult(const float o) const;
+      ML_CONSTEXPR const Vec4 mult(const float o) const;
       /** External scalar division */
-      const Vec4 div(const float o) const;
+      ML_CONSTEXPR const Vec4 div(const float o) const;
       /** Dot product */
-      float dot(const Vec4& o) const;
+      ML_CONSTEXPR float dot(const Vec4& o) const;
 
       /* ADDITIONAL METHODS */
       /** Set Vector to Zeros **/
-      void zeros();
+      ML_CONSTEXPR void zeros();
     private:
 #if ML_USE_SSE
       __m128 vec_;
 #else  
       alignas(alignof(float)) float vec_[4];
-      static uint32_t vec_size_;
 #endif
   };
 
+  static_assert(std::is_trivially_copyable<Vec4>::value, "Vec4 must stay trivially copyable");
+
   /** Output stream for vec3 */
   std::ostream& operator<<(std::ostream& left, const Vec4& v);
 
+//Implementation, inlined so the vector math stays in registers
+#if ML_USE_SSE
+
+#include "vec4_sse.h"
+
+#else
+#pragma region Constructors
+  ML_CONSTEXPR Vec4::Vec4() : vec_{ 0.0f, 0.0f, 0.0f, 0.0f } {}
+
+  ML_CONSTEXPR Vec4::Vec4(const Vec3& o, const float u4) : vec_{ o.x(), o.y(), o.z(), u4 } {}
+
+  ML_CONSTEXPR Vec4::Vec4(const float u1, const float u2, const float u3, const float u4) : vec_{ u1, u2, u3, u4 } {}
+#pragma endregion
+
+#pragma region Components
+  ML_CONSTEXPR const float Vec4::x() const {
+    return vec_[X];
+  }
+
+  ML_CONSTEXPR float& Vec4::x() {
+    return vec_[X];
+  }
+
+  ML_CONSTEXPR const float Vec4::y() const {
+    return vec_[Y];
+  }
+
+  ML_CONSTEXPR float& Vec4::y() {
+    return vec_[Y];
+  }
+
+  ML_CONSTEXPR const float Vec4::z() const {
+    return vec_[Z];
+  }
+
+  ML_CONSTEXPR float& Vec4::z() {
+    return vec_[Z];
+  }
+
+  ML_CONSTEXPR const float Vec4::w() const {
+    return vec_[W];
+  }
+
+  ML_CONSTEXPR float& Vec4::w() {
+    return vec_[W];
+  }
+#pragma endregion
+
+#pragma region Operators
+  ML_CONSTEXPR const float Vec4::operator[](unsigned short index) const {
+    assert(index<4);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR float& Vec4::operator[](unsigned short index) {
+    assert(index<4);
+    return vec_[index];
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::operator-() const {
+    return Vec4(-vec_[X], -vec_[Y], -vec_[Z], -vec_[W]);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR Vec4& Vec4::addEq(const Vec4& o) {
+    vec_[X] += o.x();
+    vec_[Y] += o.y();
+    vec_[Z] += o.z();
+    vec_[W] += o.w();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::subEq(const Vec4& o) {
+    vec_[X] -= o.x();
+    vec_[Y] -= o.y();
+    vec_[Z] -= o.z();
+    vec_[W] -= o.w();
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::multEq(const float o) {
+    vec_[X] *= o;
+    vec_[Y] *= o;
+    vec_[Z] *= o;
+    vec_[W] *= o;
+    return *this;
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::divEq(const float o) {
+    assert(o != 0.0f);
+    vec_[X] /= o;
+    vec_[Y] /= o;
+    vec_[Z] /= o;
+    vec_[W] /= o;
+    return *this;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec4::dot(const Vec4& o) const {
+    return (vec_[X] * o.x()) + (vec_[Y] * o.y()) + (vec_[Z] * o.z()) + (vec_[W] * o.w());
+  }
+
+  inline float Vec4::length() const {
+    return (float)sqrt((double)dot(*this));
+  }
+
+  inline const Vec4 Vec4::normalized() const {
+    float module = length();
+    assert(module != 0);
+    return Vec4(vec_[X] / module, vec_[Y] / module, vec_[Z] / module, vec_[W] / module);
+  }
+#pragma endregion
+
+#pragma region Additional
+  ML_CONSTEXPR void Vec4::zeros() {
+    vec_[X] = 0.0f;
+    vec_[Y] = 0.0f;
+    vec_[Z] = 0.0f;
+    vec_[W] = 0.0f;
+  }
+#pragma endregion
+#endif
+
+//Common Implementations
+
+#pragma region Operators
+  ML_CONSTEXPR Vec4& Vec4::operator+=(const Vec4& o) {
+    return addEq(o);
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::operator-=(const Vec4& o) {
+    return subEq(o);
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::operator*=(const float o) {
+    return multEq(o);
+  }
+
+  ML_CONSTEXPR Vec4& Vec4::operator/=(const float o) {
+    assert(o != 0);
+    return divEq(o);
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::operator+(const Vec4& o) const {
+    return add(o);
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::operator-(const Vec4& o) const {
+    return sub(o);
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::operator*(const float o) const {
+    return mult(o);
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::operator/(const float o) const {
+    assert(o != 0);
+    return div(o);
+  }
+
+  ML_CONSTEXPR float Vec4::operator*(const Vec4& o) const {
+    return dot(o);
+  }
+
+  ML_CONSTEXPR const bool Vec4::operator==(const Vec4& o) const {
+    return (x() == o.x()) && (y() == o.y()) && (z() == o.z()) && (w() == o.w());
+  }
+
+  ML_CONSTEXPR const bool Vec4::operator!=(const Vec4& o) const {
+    return !(*this == o);
+  }
+#pragma endregion
+
+#pragma region Named Operators
+  ML_CONSTEXPR const Vec4 Vec4::add(const Vec4& o) const {
+    Vec4 result = *this;
+    result.addEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::sub(const Vec4& o) const {
+    Vec4 result = *this;
+    result.subEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::mult(const float o) const {
+    Vec4 result = *this;
+    result.multEq(o);
+    return result;
+  }
+
+  ML_CONSTEXPR const Vec4 Vec4::div(const float o) const {
+    assert(o != 0.0f);
+    Vec4 result = *this;
+    result.divEq(o);
+    return result;
+  }
+#pragma endregion
+
+#pragma region Vector Ops
+  ML_CONSTEXPR float Vec4::length2() const {
+    return dot(*this);
+  }
+#pragma endregion
 }
 #endif
\ No newline at end of file
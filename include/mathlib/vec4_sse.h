@@ -6,110 +6,99 @@
 //----------------------------------------------------------------------------
 
 #pragma region Constructors
-  Vec4::Vec4() {
+  inline Vec4::Vec4() {
     vec_ = _mm_setzero_ps();
   }
 
-  Vec4::Vec4(const Vec4& o) {
-    vec_ = o.vec_;
-  }
-
-  Vec4::Vec4(const Vec3& o, const float u4) {
+  inline Vec4::Vec4(const Vec3& o, const float u4) {
     vec_ = _mm_set_ps(u4, o.z(), o.y(), o.x());   //high to low MSB u4|z|y|x LSB
   }
 
-  Vec4::Vec4(const float u1, const float u2, const float u3, const float u4) {
+  inline Vec4::Vec4(const float u1, const float u2, const float u3, const float u4) {
     vec_ = _mm_set_ps(u4, u3, u2, u1);          //high to low MSB u4|u3|u2|u1 LSB
   }
 
-  Vec4::Vec4(const __m128 o) {
+  inline Vec4::Vec4(const __m128 o) {
     vec_ = o;
   }
 #pragma endregion
 
 #pragma region Components
-  const float Vec4::x() const {
-    return vec_.m128_f32[X];
+  inline const float Vec4::x() const {
+    return sseLane(vec_, X);
   }
 
-  float& Vec4::x() {
-    return vec_.m128_f32[X];
+  inline float& Vec4::x() {
+    return sseLane(vec_, X);
   }
 
-  const float Vec4::y() const {
-    return vec_.m128_f32[Y];
+  inline const float Vec4::y() const {
+    return sseLane(vec_, Y);
   }
 
-  float& Vec4::y() {
-    return vec_.m128_f32[Y];
+  inline float& Vec4::y() {
+    return sseLane(vec_, Y);
   }
 
-  const float Vec4::z() const {
-    return vec_.m128_f32[Z];
+  inline const float Vec4::z() const {
+    return sseLane(vec_, Z);
   }
 
-  float& Vec4::z() {
-    return vec_.m128_f32[Z];
+  inline float& Vec4::z() {
+    return sseLane(vec_, Z);
   }
 
-  const float Vec4::w() const {
-    return vec_.m128_f32[W];
+  inline const float Vec4::w() const {
+    return sseLane(vec_, W);
   }
 
-  float& Vec4::w() {
-    return vec_.m128_f32[W];
+  inline float& Vec4::w() {
+    return sseLane(vec_, W);
   }
 
-  const __m128 Vec4::sse_val() const {
+  inline const __m128 Vec4::sse_val() const {
     return vec_;
   }
 
-  __m128& Vec4::sse_val() {
+  inline __m128& Vec4::sse_val() {
     return vec_;
   }
 #pragma endregion
 
 #pragma region Operators
-  Vec4& Vec4::operator=(const Vec4& o) {
-    if (this != &o) {
-      vec_ = o.vec_;
-    }
-    return *this;
-  }
-
-  const float Vec4::operator[](uint16_t index) const {  
+  inline const float Vec4::operator[](uint16_t index) const {  
     assert(index < 4);
-    return vec_.m128_f32[index];
+    return sseLane(vec_, index);
   }
 
-  float& Vec4::operator[](uint16_t index) {  
+  inline float& Vec4::operator[](uint16_t index) {  
     assert(index < 4);
-    return vec_.m128_f32[index];
+    return sseLane(vec_, index);
   }
 
-  const Vec4 Vec4::operator-() const {
-    return Vec4(-vec_.m128_f32[X], -vec_.m128_f32[Y], -vec_.m128_f32[Z], -vec_.m128_f32[W]);
+  inline const Vec4 Vec4::operator-() const {
+    return Vec4(-sseLane(vec_, X), -sseLane(vec_, Y), -sseLane(vec_, Z), -sseLane(vec_, W));
   }
 #pragma endregion
 
 #pragma region Named Operators
-  Vec4& Vec4::addEq(const Vec4& o) {
+  inline Vec4& Vec4::addEq(const Vec4& o) {
     vec_ = _mm_add_ps(vec_, o.vec_);
     return *this;
   }
 
-  Vec4& Vec4::subEq(const Vec4& o) {
+  inline Vec4& Vec4::subEq(const Vec4& o) {
     vec_ = _mm_sub_ps(vec_, o.vec_);
     return *this;
   }
 
-  Vec4& Vec4::multEq(const float o) {
+  inline Vec4& Vec4::multEq(const float o) {
     __m128 aux = _mm_set1_ps(o);
     vec_ = _mm_mul_ps(vec_, aux);
     return *this;
   }
 
-  Vec4& Vec4::divEq(const float o) {
+  inline Vec4& Vec4::divEq(const float o) {
     assert(o != 0.0f);
     __m128 aux = _mm_set1_ps(o);
     vec_ = _mm_div_ps(vec_, aux);
@@ -118,7 +107,7 @@
 #pragma endregion
 
 #pragma region Vector Ops
-  float Vec4::dot(const Vec4& o) const {
+  inline float Vec4::dot(const Vec4& o) const {
     __m128 aux=_mm_mul_ps(vec_,o.vec_);
     aux=_mm_hadd_ps(aux,aux);
     aux=_mm_hadd_ps(aux,aux);
@@ -127,7 +116,7 @@
     return res;
   }
 
-  float Vec4::length() const {
+  inline float Vec4::length() const {
     __m128 aux = _mm_mul_ps(vec_, vec_);
     aux = _mm_hadd_ps(aux, aux);
     float res;
@@ -135,7 +124,7 @@
     return res;
   }
 
-  const Vec4 Vec4::normalized() const {
+  inline const Vec4 Vec4::normalized() const {
     __m128 aux = _mm_mul_ps(vec_, vec_);    
     aux = _mm_hadd_ps(aux, aux);
     return Vec4(_mm_div_ps(vec_, _mm_sqrt_ps(_mm_hadd_ps(aux, aux))));
@@ -143,7 +132,7 @@
 #pragma endregion
 
 #pragma region Additional
-  void Vec4::zeros() {
+  inline void Vec4::zeros() {
     vec_ = _mm_setzero_ps();
   }
 #pragma endregion
\ No newline at end of file
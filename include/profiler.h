@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__ 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//build with PROFILER_ENABLED=0 to compile every PROFILE_SCOPE out
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+//collects timed scopes from every thread into per thread rings, the owner
+//thread writes without locking. readers (trace, summary) may run while other
+//threads record, only the oldest events of a ring that wraps meanwhile can tear
+class Profiler {
+  public:
+    ~Profiler() {}
+    Profiler(Profiler const&) = delete;
+    void operator=(Profiler const&) = delete;
+
+    static Profiler& instance() {
+      static Profiler instance;
+      return  instance;
+    }
+
+    //nanoseconds from a monotonic high resolution clock
+    static uint64_t now();
+
+    //F7 in game, paused scopes record nothing and the rings keep what they had
+    void setEnabled(const bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    //name must outlive the profiler, scopes are grouped by its address
+    void record(const char* name, const uint64_t start, const uint64_t end);
+
+    //every event still in the rings as chrome://tracing json
+    bool writeChromeTrace(const char* path);
+    //one line per scope name with its mean ms per frame for the events
+    //ended after since, slowest first
+    void summary(const uint64_t since, const uint32_t frames, char* text, const size_t size);
+  private:
+    Profiler() {}
+
+    struct Event {
+      const char* name;
+      uint64_t start;
+      uint64_t end;
+    };
+
+    struct ThreadRing {
+      uint32_t tid;
+      std::vector<Event> events;
+      std::atomic<uint64_t> count{ 0 };     //events ever written, the ring keeps the last PROFILER_EVENTS
+    };
+
+    ThreadRing* ring();
+
+    static thread_local ThreadRing* thread_ring_;
+    std::mutex mutex_;                      //guards rings_ when a thread records its first event
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+    std::atomic<bool> enabled_{ true };
+};
+
+//times the enclosing scope
+class ProfileScope {
+  public:
+    explicit ProfileScope(const char* name) {
+      if (Profiler::instance().isEnabled()) {
+        name_ = name;
+        start_ = Profiler::now();
+      }
+    };
+    ~ProfileScope() {
+      if (name_) Profiler::instance().record(name_, start_, Profiler::now());
+    };
+  private:
+    const char* name_ = nullptr;
+    uint64_t start_ = 0;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)
+#endif
+
+#endif
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __RANDOM_H__
+#define __RANDOM_H__ 1
+
+#include <cstdint>
+
+//small seeded generator (PCG32), every owner keeps its own stream so the
+//sequence it sees does not depend on update order or thread count.
+//there are no per-thread streams on purpose: which agents a worker runs
+//changes with the thread count and the mode buckets, so draws from a
+//thread's stream would not replay. bodies and groups own their streams
+class Random {
+  public:
+    Random() { seed(0, 0); };
+    Random(const uint64_t seed_value, const uint64_t stream) { seed(seed_value, stream); };
+
+    //same seed and stream always give the same sequence
+    void seed(const uint64_t seed_value, const uint64_t stream) {
+      state_ = 0;
+      inc_ = (stream << 1) | 1;
+      next();
+      state_ += seed_value;
+      next();
+    }
+
+    uint32_t next() {
+      const uint64_t old = state_;
+      state_ = old * 6364136223846793005ULL + inc_;
+      const uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+      const uint32_t rot = (uint32_t)(old >> 59);
+      return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+    //uniform in [0, 1)
+    float nextFloat() { return (float)(next() >> 8) * (1.0f / 16777216.0f); }
+    //uniform in [a, b)
+    float range(const float a, const float b) { return a + (nextFloat() * (b - a)); }
+
+    //count draws of range(a, b) into out, the same values as calling it count times.
+    //lets a batched kernel take its random input as a plain array
+    void fill(float* out, const uint32_t count, const float a, const float b) {
+      const float span = b - a;
+      for (uint32_t i = 0; i < count; ++i) {
+        out[i] = a + (nextFloat() * span);
+      }
+    }
+  private:
+    uint64_t state_;
+    uint64_t inc_;
+};
+
+#endif
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__ 1
+
+#include <body.h>
+#include <debug_draw.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+//what the renderer needs from one simulation tick, never changed once published
+struct Snapshot {
+  struct Transform {
+    float x;
+    float y;
+    float orientation;
+  };
+
+  struct Group {
+    Body::Color color;
+    std::vector<Transform> previous;      //one tick before agents, same order
+    std::vector<Transform> agents;
+  };
+
+  //how far the wall clock is from previous (0) to agents (1), the simulation
+  //reaches agents when the tick that follows it is due
+  float alpha(const uint32_t now) const {
+    if ((tick_ms == 0) || (now >= next_tick_time)) return 1.0f;
+    const float left = (float)(next_tick_time - now) / tick_ms;
+    return (left >= 1.0f) ? 0.0f : (1.0f - left);
+  }
+
+  //agent i of group blended by alpha, agents that wrapped around the world jump
+  Transform blend(const Group& group, const uint32_t i, const float alpha) const;
+
+  uint32_t tick = 0;
+  uint32_t next_tick_time = 0;    //SDL_GetTicks() time the next tick is due
+  uint32_t tick_ms = 0;           //wall time between ticks, slow motion included
+  std::vector<Group> groups;
+  DebugDraw::Frame debug;
+};
+
+//triple buffer between the simulation thread, which fills back() and
+//publishes it, and the render thread, which draws the latest published one.
+//the lock only covers pointer swaps, neither side waits for the other to finish
+class SnapshotExchange {
+  public:
+    SnapshotExchange() {};
+    ~SnapshotExchange() {};
+
+    //simulation thread, the snapshot being filled
+    Snapshot* back() { return back_; }
+    //simulation thread, makes back() the latest snapshot and hands out a free one
+    void publish();
+    //render thread, the latest published snapshot, valid until the next acquire()
+    const Snapshot* acquire();
+  private:
+    Snapshot buffers_[3];
+    Snapshot* back_ = &buffers_[0];
+    Snapshot* ready_ = &buffers_[1];
+    Snapshot* front_ = &buffers_[2];
+    bool fresh_ = false;          //ready_ was published after the last acquire()
+    std::mutex mutex_;
+};
+
+#endif
@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __SPATIAL_GRID_H__
+#define __SPATIAL_GRID_H__ 1
+
+#include <mathlib/vec2.h>
+
+#include <cstdint>
+#include <vector>
+
+//uniform grid over the world, rebuilt from scratch each tick
+//entries are stored sorted by cell so a query walks contiguous ranges
+class SpatialGrid {
+  public:
+    SpatialGrid() {};
+    ~SpatialGrid() {};
+
+    void init(const float width, const float height, const float cell_size);
+
+    //rebuild: clear(), insert() every element, then build()
+    void clear();
+    void insert(const uint32_t index, const MathLib::Vec2& pos);
+    void build();
+
+    //calls fn(index) for every element stored in the cells overlapping
+    //the square [pos - radius, pos + radius], the caller does the exact test
+    template <typename Fn>
+    void forEachCandidate(const MathLib::Vec2& pos, const float radius, Fn fn) const {
+      const int32_t min_x = cellCoord(pos.x() - radius, cols_);
+      const int32_t max_x = cellCoord(pos.x() + radius, cols_);
+      const int32_t min_y = cellCoord(pos.y() - radius, rows_);
+      const int32_t max_y = cellCoord(pos.y() + radius, rows_);
+
+      for (int32_t y = min_y; y <= max_y; ++y) {
+        const uint32_t row = y * cols_;
+        for (int32_t x = min_x; x <= max_x; ++x) {
+          const uint32_t cell = row + x;
+          for (uint32_t i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) {
+            fn(sorted_[i]);
+          }
+        }
+      }
+    }
+
+  private:
+    int32_t cellCoord(const float v, const int32_t n) const {
+      const int32_t c = (int32_t)(v * inv_cell_size_);
+      return (c < 0) ? 0 : ((c >= n) ? n - 1 : c);
+    }
+
+    float inv_cell_size_ = 1.0f;
+    int32_t cols_ = 1;
+    int32_t rows_ = 1;
+
+    struct Entry {
+      uint32_t cell;
+      uint32_t index;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> cell_start_;      //cols_ * rows_ + 1 offsets into sorted_
+    std::vector<uint32_t> sorted_;
+    std::vector<uint32_t> cursor_;
+};
+
+#endif
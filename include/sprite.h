@@ -10,6 +10,8 @@
 
 #include <texture.h>
 
+class SpriteBatch;
+
 class Sprite : public Texture {
 public:
   Sprite() {};
@@ -20,6 +22,10 @@ public:
   void setRotation(const float angle);
   void setVisible(const bool visible = true);
   void render() const;
+  //queues the sprite in batch instead of drawing it now
+  void render(SpriteBatch* batch) const;
+  //queues the sprite centered at x, y instead of its own position and rotation
+  void render(SpriteBatch* batch, const float x, const float y, const float angle) const;
 private:
   SDL_Point position_ { 0, 0 };
   float angle_{ 0.0f };
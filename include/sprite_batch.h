@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __SPRITE_BATCH_H__
+#define __SPRITE_BATCH_H__ 1
+
+#include <SDL/SDL.h>
+
+#include <vector>
+
+//collects sprites and draws them grouped by texture. with SDL 2.0.18 or
+//newer each texture is a single SDL_RenderGeometry call, older versions
+//fall back to one SDL_RenderCopyEx per sprite, still without texture switches
+class SpriteBatch {
+  public:
+    SpriteBatch() {};
+    ~SpriteBatch() {};
+
+    //x, y is the upper left corner, angle in radians around the center
+    void add(SDL_Texture* texture, const int x, const int y, const int w, const int h, const float angle);
+    //draws everything added since the last flush, keeps the buffers for the next frame
+    void flush();
+  private:
+    struct Quad {
+      int x;
+      int y;
+      int w;
+      int h;
+      float angle;
+    };
+
+    struct Bucket {
+      SDL_Texture* texture;
+      std::vector<Quad> quads;
+    };
+
+    std::vector<Bucket> buckets_;     //one per texture, a handful at most
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+#endif
+};
+
+#endif
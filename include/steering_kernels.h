@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __STEERING_KERNELS_H__
+#define __STEERING_KERNELS_H__ 1
+
+#include <cstdint>
+
+//group wide versions of the basic steering behaviours, they work over
+//structure of arrays input and output and evaluate 8 (AVX), 4 (SSE2)
+//or 1 (scalar fallback) agents per instruction.
+//the math matches Body::seek, flee and arrive, ML_FAST_MATH included (the
+//normalize goes through the same rsqrt), except that a zero length
+//direction gives a zero steering instead of a NaN
+class SteeringKernels {
+  public:
+    //instruction set the kernels were compiled for
+    static const char* isa();
+
+    static void seek(const uint32_t count, const float* pos_x, const float* pos_y,
+      const float target_x, const float target_y, const float max_acc,
+      float* linear_x, float* linear_y);
+
+    static void flee(const uint32_t count, const float* pos_x, const float* pos_y,
+      const float target_x, const float target_y, const float max_acc,
+      float* linear_x, float* linear_y);
+
+    static void arrive(const uint32_t count, const float* pos_x, const float* pos_y,
+      const float* vel_x, const float* vel_y,
+      const float target_x, const float target_y, const float max_speed, const float max_acc,
+      const float slow_radius, const float time_to_target,
+      float* linear_x, float* linear_y);
+};
+
+#endif
@@ -16,6 +16,8 @@ class Texture {
     Texture();
     ~Texture();
 
+    //image textures come from the TextureCache and are shared with every
+    //Texture loaded from the same path, so the setters below affect all of them
     bool loadFromFile(const char* path);
     bool loadFromRenderedText(const char* textureText, const SDL_Color& textColor, TTF_Font* font, const bool shadow = false, const bool wrapped = false);
     void free();
@@ -25,9 +27,11 @@ class Texture {
     int getWidth() const { return width_; };
     int getHeight() const { return height_; };
   protected:
+    SDL_Texture* getTexture() const { return texture_; }
     void renderText(const uint32_t x, const uint32_t y, const SDL_Rect* clip = nullptr, const float angle = 0.0, const SDL_Point* center = nullptr, const SDL_RendererFlip flip = SDL_FLIP_NONE) const;
   private:
     SDL_Texture * texture_ = nullptr;
+    bool shared_ = false;             //owned by the TextureCache
     int width_ = 0;
     int height_ = 0;
     uint32_t r_mask_, g_mask_, b_mask_, a_mask_;
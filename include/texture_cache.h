@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __TEXTURE_CACHE_H__
+#define __TEXTURE_CACHE_H__ 1
+
+#include <SDL/SDL.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+//reference counted image textures keyed by path, every Texture loaded from
+//the same file shares one SDL_Texture, destroyed when the last one releases it
+class TextureCache {
+  public:
+    ~TextureCache() {}
+    TextureCache(TextureCache const&) = delete;
+    void operator=(TextureCache const&) = delete;
+
+    static TextureCache& instance() {
+      static TextureCache instance;
+      return  instance;
+    }
+
+    //returns the texture of path loading it on first use, nullptr on failure
+    //or when headless. every successful acquire needs a release
+    SDL_Texture* acquire(const char* path, int* width, int* height);
+    void release(SDL_Texture* texture);
+
+    //number of distinct textures alive
+    uint32_t size() const { return (uint32_t)entries_.size(); }
+  private:
+    TextureCache() {}
+
+    struct Entry {
+      SDL_Texture* texture;
+      int width;
+      int height;
+      uint32_t refs;
+    };
+
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+#endif
@@ -26,6 +26,8 @@ class Window {
 
     SDL_Window* getWindow() const { return window_; }
     SDL_Renderer* getRenderer() const { return renderer_; }
+    //true until init() creates the renderer, nothing gets drawn or loaded in this mode
+    bool isHeadless() const { return renderer_ == nullptr; }
   private:
     Window() {}
 
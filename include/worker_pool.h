@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#ifndef __WORKER_POOL_H__
+#define __WORKER_POOL_H__ 1
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+  public:
+    ~WorkerPool() {}
+    WorkerPool(WorkerPool const&) = delete;
+    void operator=(WorkerPool const&) = delete;
+
+    static WorkerPool& instance() {
+      static WorkerPool instance;
+      return  instance;
+    }
+
+    //n_threads counts the calling thread, 0 uses every hardware thread
+    void init(const uint32_t n_threads = 0);
+    void shutdown();
+
+    uint32_t size() const { return (uint32_t)threads_.size() + 1; }
+
+    //splits [0, count) in chunks of grain and runs fn(begin, end) for each of
+    //them on the pool and the calling thread, returns when all are done.
+    //runs inline when the pool was not initialized
+    void parallelFor(const uint32_t count, const uint32_t grain,
+      const std::function<void(const uint32_t, const uint32_t)>& fn);
+  private:
+    WorkerPool() {}
+
+    void workerLoop(uint32_t seen);
+    void runChunks();
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+
+    const std::function<void(const uint32_t, const uint32_t)>* job_ = nullptr;
+    uint32_t count_ = 0;
+    uint32_t grain_ = 1;
+    std::atomic<uint32_t> next_{ 0 };
+    uint32_t generation_ = 0;
+    uint32_t active_ = 0;
+    bool quit_ = false;
+};
+
+#endif
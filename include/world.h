@@ -12,30 +12,55 @@
 #include <defines.h>
 
 #include <cstdio>
+#include <vector>
 #include <agent.h>
 #include <AgentGroup.h>
+#include <command.h>
+#include <kinematic_store.h>
+#include <snapshot.h>
 
 using MathLib::Vec2;
 
 class World {
   public:
-    World() {
-      target_.init(this, Body::Color::Red, Body::Type::Manual);
-      ia_.init(this, Body::Color::Green, Body::Type::Autonomous);
-    };
+    World() {};
     ~World() {
       target_.shutdown();
       ia_.shutdown();
     };
 
-    void update(const float dt) { target_.update(dt); ia_.update(dt); }
-    void render() { target_.render(); ia_.render(); }
+    //the same seed and commands always give the same simulation
+    void init(const uint32_t n_agents, const uint64_t seed) {
+      seed_ = seed;
+      next_stream_ = 0;
+      tick_ = 0;
+      target_.init(this, Body::Color::Red, Body::Type::Manual, &kinematic_);
+      ia_.init(this, Body::Color::Green, Body::Type::Autonomous, n_agents);
+    }
+
+    //applies the commands stamped for this tick and advances one fixed TICK_MS step
+    void step(const std::vector<Command>& commands);
+    void apply(const Command& command);
+    //copies the agent transforms into out and captures this tick's debug draw
+    void snapshot(Snapshot* out) const;
 
     Agent* target() { return &target_; }
     AgentGroup* ia() { return &ia_; }
+
+    uint32_t tick() const { return tick_; }
+    uint64_t seed() const { return seed_; }
+    //random stream for the next object created, in creation order
+    uint64_t nextStream() { return next_stream_++; }
+    //hash of the whole simulation state, equal runs give equal checksums
+    uint64_t checksum() const;
   private:
+    KinematicBuffer kinematic_;     //standalone agents, group agents live in their AgentGroup
     Agent target_;
     AgentGroup ia_;
+
+    uint32_t tick_ = 0;
+    uint64_t seed_ = 0;
+    uint64_t next_stream_ = 0;
 };
 
 #endif
\ No newline at end of file
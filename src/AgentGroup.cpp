@@ -1,18 +1,25 @@
 #include <defines.h>
 #include <AgentGroup.h>
 #include <MathLib/vec2.h>
+#include <profiler.h>
+#include <worker_pool.h>
+#include <world.h>
 
 using MathLib::Vec2;
 
-void AgentGroup::init(World* world, const Body::Color color, const Body::Type type) {
+void AgentGroup::init(World* world, const Body::Color color, const Body::Type type, const uint32_t count) {
   world_ = world;
-  for (int i = 0; i < N_AGENTS; i++) {
-    agents_[i].init(world, color, type);
-    agents_[i].setAgentGroup(this);
-    const float x = randomFloat(-10.0f, 10.0f);
-    const float y = randomFloat(-10.0f, 10.0f);
-    agents_[i].getKinematic()->position = Vec2(WINDOW_WIDTH / 2 + x, WINDOW_HEIGHT / 2 + y);
+  color_ = color;
+  type_ = type;
+  rng_.seed(world->seed(), world->nextStream());
+  grid_.init(WINDOW_WIDTH, WINDOW_HEIGHT, NEIGHBOUR_RADIUS);
+  agents_.clear();
+  kinematic_.clear();
+  reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    addAgent();
   }
+  rebuildGrid();
 }
 
 void AgentGroup::shutdown() {
@@ -20,23 +27,135 @@ void AgentGroup::shutdown() {
 }
 
 void AgentGroup::update(const uint32_t dt) {
-  for (int i = 0; i < N_AGENTS; i++) {
-    agents_[i].update(dt);
+  PROFILE_SCOPE("AgentGroup::update");
+  //agents read the front buffer and write the back one, so they can run in any order
+  rebuildGrid();
+  bucketByMode();
+
+  //each mode runs over its own bucket, autonomous groups use the batched version when there is one
+  const bool autonomous = (type_ == Body::Type::Autonomous);
+  const KinematicStatus target = world_->target()->getKinematic();
+  const KinematicStore& kinematic = kinematic_.front();
+  for (auto& values : gather_) {
+    values.resize(size());
+  }
+  steering_x_.resize(size());
+  steering_y_.resize(size());
+
+  for (uint32_t m = 0; m < Body::steering_modes_; ++m) {
+    const uint32_t first = bucket_begin_[m];
+    const uint32_t count = bucket_begin_[m + 1] - first;
+    if (count == 0) continue;
+    const Body::SteeringMode mode = (Body::SteeringMode)m;
+    const bool batched = autonomous && Body::hasBatch(mode);
+
+    WorkerPool::instance().parallelFor(count, UPDATE_GRAIN, [&](const uint32_t begin, const uint32_t end) {
+      const uint32_t* agents = order_.data() + first;
+      if (batched) {
+        {
+          PROFILE_SCOPE(Body::steeringName(mode));
+          for (uint32_t i = begin; i < end; ++i) {
+            gather_[0][first + i] = kinematic.posX()[agents[i]];
+            gather_[1][first + i] = kinematic.posY()[agents[i]];
+            gather_[2][first + i] = kinematic.velX()[agents[i]];
+            gather_[3][first + i] = kinematic.velY()[agents[i]];
+          }
+          Body::steerBatch(mode, end - begin, gather_[0].data() + first + begin, gather_[1].data() + first + begin,
+            gather_[2].data() + first + begin, gather_[3].data() + first + begin, target,
+            steering_x_.data() + first + begin, steering_y_.data() + first + begin);
+        }
+        PROFILE_SCOPE("integrate");
+        Steering steering;
+        for (uint32_t i = begin; i < end; ++i) {
+          steering.linear = Vec2(steering_x_[first + i], steering_y_[first + i]);
+          agents_[agents[i]]->update(dt, steering);
+        }
+      } else {
+        PROFILE_SCOPE(Body::steeringName(mode));
+        for (uint32_t i = begin; i < end; ++i) {
+          agents_[agents[i]]->update(dt, target);
+        }
+      }
+    });
   }
+  kinematic_.swap();
 }
 
-void AgentGroup::render() const {
-  for (int i = 0; i < N_AGENTS; i++) {
-    agents_[i].render();
+void AgentGroup::recordDebug() const {
+  for (const auto& agent : agents_) {
+    agent->recordDebug();
   }
 }
 
 void AgentGroup::setSteering(Body::SteeringMode steering) {
-  for (int i = 0; i < N_AGENTS; i++) {
-    agents_[i].setSteering(steering);
+  steering_mode_ = steering;
+  for (auto& agent : agents_) {
+    agent->setSteering(steering);
   }
 }
 
 Agent* AgentGroup::getAgent(int i) {
-  return &agents_[i];
+  return agents_[i].get();
+}
+
+void AgentGroup::reserve(const uint32_t count) {
+  agents_.reserve(count);
+  kinematic_.reserve(count);
+}
+
+Agent* AgentGroup::addAgent() {
+  agents_.emplace_back(new Agent());
+  Agent* agent = agents_.back().get();
+  agent->init(world_, color_, type_, &kinematic_);
+  agent->setAgentGroup(this);
+  agent->setSteering(steering_mode_);
+
+  KinematicStatus status = agent->getKinematic();
+  float offset[2];
+  rng_.fill(offset, 2, -10.0f, 10.0f);
+  status.position = Vec2(WINDOW_WIDTH / 2 + offset[0], WINDOW_HEIGHT / 2 + offset[1]);
+  agent->setKinematic(status);
+  return agent;
+}
+
+void AgentGroup::removeAgent(const uint32_t i) {
+  agents_[i]->shutdown();
+  kinematic_.remove(i);
+  if (i != agents_.size() - 1) {
+    agents_[i] = std::move(agents_.back());
+    agents_[i]->setKinematicIndex(i);
+  }
+  agents_.pop_back();
+}
+
+void AgentGroup::bucketByMode() {
+  for (auto& begin : bucket_begin_) {
+    begin = 0;
+  }
+  for (const auto& agent : agents_) {
+    ++bucket_begin_[(uint32_t)agent->getSteering() + 1];
+  }
+  for (uint32_t m = 0; m < Body::steering_modes_; ++m) {
+    bucket_begin_[m + 1] += bucket_begin_[m];
+  }
+
+  //fill from a copy of the starts so each bucket keeps agent index order
+  uint32_t next[Body::steering_modes_];
+  for (uint32_t m = 0; m < Body::steering_modes_; ++m) {
+    next[m] = bucket_begin_[m];
+  }
+  order_.resize(size());
+  for (uint32_t i = 0; i < size(); ++i) {
+    order_[next[(uint32_t)agents_[i]->getSteering()]++] = i;
+  }
+}
+
+void AgentGroup::rebuildGrid() {
+  PROFILE_SCOPE("neighbour grid");
+  grid_.clear();
+  const KinematicStore& kinematic = kinematic_.front();
+  for (uint32_t i = 0; i < kinematic.size(); i++) {
+    grid_.insert(i, kinematic.position(i));
+  }
+  grid_.build();
 }
\ No newline at end of file
@@ -8,9 +8,10 @@
 #include <agent.h>
 #include <world.h>
 
-void Agent::init(World* world, const Body::Color color, const Body::Type type) {
+void Agent::init(World* world, const Body::Color color, const Body::Type type, KinematicBuffer* kinematic) {
   world_ = world;
-  body_.init(color, type);
+  body_.init(color, type, kinematic);
+  body_.seedRandom(world->seed(), world->nextStream());
   mind_.init(world, &body_);
 }
 
@@ -23,6 +24,12 @@ void Agent::update(const uint32_t dt) {
   body_.update(dt);
 }
 
-void Agent::render() const {
-  body_.render();
-}
\ No newline at end of file
+void Agent::update(const uint32_t dt, const KinematicStatus& target) {
+  mind_.update(dt);
+  body_.update(dt, target);
+}
+
+void Agent::update(const uint32_t dt, const Steering& steering) {
+  mind_.update(dt);
+  body_.update(dt, steering);
+}
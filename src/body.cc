@@ -10,177 +10,227 @@
 #include <AgentGroup.h>
 #include <defines.h>
 #include <debug_draw.h>
+#include <kinematic_store.h>
+#include <steering_kernels.h>
 
 const float SQUARED_RADIUS = 25.0f;
 const float TIME_TO_TARGET = 0.5f;
+const float MAX_ACCELERATION = 100.0f;
+const float ARRIVE_SLOW_RADIUS = 150.0f;
+const float ARRIVE_TIME_TO_TARGET = 0.5f;
 
-void Body::init(const Color color, const Type type) {
+void Body::init(const Color color, const Type type, KinematicBuffer* kinematic) {
   type_ = type;
   color_ = color;
+  kinematic_ = kinematic;
+  index_ = kinematic_->add();
 
+  steering_mode_ = SteeringMode::Kinematic_Seek;
+}
+
+const char* Body::spritePath(const Color color) {
   switch(color) {
-    case Color::Green: sprite_.loadFromFile(AGENT_GREEN_PATH); break;
-    case Color::Blue: sprite_.loadFromFile(AGENT_BLUE_PATH); break;
-    case Color::Purple: sprite_.loadFromFile(AGENT_PURPLE_PATH); break;
-    case Color::Red: sprite_.loadFromFile(AGENT_RED_PATH); break;
-    default: sprite_.loadFromFile(AGENT_GREEN_PATH);
+    case Color::Green: return AGENT_GREEN_PATH;
+    case Color::Blue: return AGENT_BLUE_PATH;
+    case Color::Purple: return AGENT_PURPLE_PATH;
+    case Color::Red: return AGENT_RED_PATH;
   }
+  return AGENT_GREEN_PATH;
+}
 
-  steering_mode_ = SteeringMode::Kinematic_Seek;
+const Body::Behaviour Body::behaviours_[Body::steering_modes_] = {
+  { "Kinematic_Seek", true, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering* kinematic_steering, Steering*) { body.kinematicSeek(character, &target, kinematic_steering); }, nullptr },
+  { "Kinematic_Flee", true, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering* kinematic_steering, Steering*) { body.kinematicFlee(character, &target, kinematic_steering); }, nullptr },
+  { "Kinematic_Arrive", true, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering* kinematic_steering, Steering*) { body.kinematicArrive(character, &target, kinematic_steering); }, nullptr },
+  { "Kinematic_Wander", true, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering* kinematic_steering, Steering*) { body.kinematicWandering(character, &target, kinematic_steering); }, nullptr },
+  { "Seek", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.seek(character, &target, steering); },
+    [](const uint32_t count, const float* pos_x, const float* pos_y, const float*, const float*,
+      const float tx, const float ty, float* linear_x, float* linear_y) {
+      SteeringKernels::seek(count, pos_x, pos_y, tx, ty, MAX_ACCELERATION, linear_x, linear_y);
+    } },
+  { "Flee", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.flee(character, &target, steering); },
+    [](const uint32_t count, const float* pos_x, const float* pos_y, const float*, const float*,
+      const float tx, const float ty, float* linear_x, float* linear_y) {
+      SteeringKernels::flee(count, pos_x, pos_y, tx, ty, MAX_ACCELERATION, linear_x, linear_y);
+    } },
+  { "Arrive", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.arrive(character, &target, steering); },
+    [](const uint32_t count, const float* pos_x, const float* pos_y, const float* vel_x, const float* vel_y,
+      const float tx, const float ty, float* linear_x, float* linear_y) {
+      SteeringKernels::arrive(count, pos_x, pos_y, vel_x, vel_y, tx, ty, max_speed_, MAX_ACCELERATION,
+        ARRIVE_SLOW_RADIUS, ARRIVE_TIME_TO_TARGET, linear_x, linear_y);
+    } },
+  { "Align", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.align(character, &target, steering); }, nullptr },
+  { "Velocity_Matching", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.velocityMatching(character, &target, steering); }, nullptr },
+  { "Pursue", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.pursue(character, &target, steering); }, nullptr },
+  { "Face", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.face(character, &target, steering); }, nullptr },
+  { "LookGoing", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.lookGoing(character, &target, steering); }, nullptr },
+  { "Wander", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.wander(character, &target, steering, &character.wander); }, nullptr },
+  { "Separation", false, [](const Body& body, KinematicStatus& character, const KinematicStatus&,
+      KinematicSteering*, Steering* steering) { body.separation(character, body.agentGroup_, steering); }, nullptr },
+  { "Cohesion", false, [](const Body& body, KinematicStatus& character, const KinematicStatus&,
+      KinematicSteering*, Steering* steering) { body.cohesion(character, body.agentGroup_, steering); }, nullptr },
+  { "Alignment", false, [](const Body& body, KinematicStatus& character, const KinematicStatus&,
+      KinematicSteering*, Steering* steering) { body.alignment(character, body.agentGroup_, steering); }, nullptr },
+  { "Flocking", false, [](const Body& body, KinematicStatus& character, const KinematicStatus& target,
+      KinematicSteering*, Steering* steering) { body.flocking(character, body.agentGroup_, &target, steering); }, nullptr },
+};
+
+const char* Body::steeringName(const SteeringMode mode) {
+  return behaviours_[(uint32_t)mode].name;
+}
+
+bool Body::hasBatch(const SteeringMode mode) {
+  return behaviours_[(uint32_t)mode].batch != nullptr;
+}
+
+void Body::steerBatch(const SteeringMode mode, const uint32_t count, const float* pos_x, const float* pos_y,
+  const float* vel_x, const float* vel_y, const KinematicStatus& target, float* linear_x, float* linear_y) {
+  behaviours_[(uint32_t)mode].batch(count, pos_x, pos_y, vel_x, vel_y,
+    target.position.x(), target.position.y(), linear_x, linear_y);
 }
 
 void Body::update(const uint32_t dt) {
-  KinematicSteering kinematicSteering;
-  Steering steering;
-  bool isKinematic = false;
   if (type_ == Type::Autonomous) {
-    switch (this->steering_mode_) {
-    case Body::SteeringMode::Kinematic_Seek: 
-      this->kinematicSeek(state_, target_->getKinematic(), &kinematicSteering);
-      isKinematic = true;
-      break;
-    case Body::SteeringMode::Kinematic_Flee: 
-      this->kinematicFlee(state_, target_->getKinematic(), &kinematicSteering);
-      isKinematic = true;
-      break;
-    case Body::SteeringMode::Kinematic_Arrive: 
-      this->kinematicArrive(state_, target_->getKinematic(), &kinematicSteering);
-      isKinematic = true;
-      break;
-    case Body::SteeringMode::Kinematic_Wander: 
-      this->kinematicWandering(state_, target_->getKinematic(), &kinematicSteering);
-      isKinematic = true;
-      break;
-    case Body::SteeringMode::Seek: 
-      this->seek(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Flee: 
-      this->flee(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Arrive: 
-      this->arrive(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Align: 
-      this->align(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Velocity_Matching: 
-      this->velocityMatching(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Pursue: 
-      this->pursue(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Face: 
-      this->face(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::LookGoing: 
-      this->lookGoing(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Wander: 
-      this->wander(state_, target_->getKinematic(), &steering);
-      break;
-    case Body::SteeringMode::Separation: 
-      this->separation(state_, agentGroup_, &steering);
-      break;
-    case Body::SteeringMode::Cohesion: 
-      this->cohesion(state_, agentGroup_, &steering);
-      break;
-    case Body::SteeringMode::Alignment: 
-      this->alignment(state_, agentGroup_, &steering);
-      break;
-    case Body::SteeringMode::Flocking: 
-      this->flocking(state_, agentGroup_, target_->getKinematic(), &steering);
-      break;
-    }
-    if (isKinematic) {
-      this->applyKinematicSteering(kinematicSteering, dt);
+    update(dt, target_->getKinematic());
+    return;
+  }
+  KinematicStatus state = kinematic_->front().get(index_);
+  updateManual(dt, &state);
+  finishUpdate(state);
+}
+
+void Body::update(const uint32_t dt, const KinematicStatus& target) {
+  KinematicStatus state = kinematic_->front().get(index_);
+  if (type_ == Type::Autonomous) {
+    const Behaviour& behaviour = behaviours_[(uint32_t)steering_mode_];
+    if (behaviour.kinematic) {
+      KinematicSteering kinematicSteering;
+      behaviour.steer(*this, state, target, &kinematicSteering, nullptr);
+      this->applyKinematicSteering(kinematicSteering, dt, &state);
     } else {
-      this->applySteering(steering, dt);
+      Steering steering;
+      behaviour.steer(*this, state, target, nullptr, &steering);
+      this->applySteering(steering, dt, &state);
     }
   } else {
-    updateManual(dt);
+    updateManual(dt, &state);
   }
 
+  finishUpdate(state);
+}
 
+void Body::update(const uint32_t dt, const Steering& steering) {
+  KinematicStatus state = kinematic_->front().get(index_);
+  this->applySteering(steering, dt, &state);
+  finishUpdate(state);
+}
 
-  sprite_.setPosition(state_.position.x(), state_.position.y());
-  sprite_.setRotation(state_.orientation);
-
+void Body::finishUpdate(const KinematicStatus& state) {
+  kinematic_->back().set(index_, state);
 }
 
-void Body::applyKinematicSteering(const KinematicSteering& steering, const uint32_t ms) {
+void Body::applyKinematicSteering(const KinematicSteering& steering, const uint32_t ms, KinematicStatus* state) {
   const float dt = ms * 0.001;
-  state_.velocity = steering.velocity;
-  state_.speed = state_.velocity.length();
-  state_.position += state_.velocity * dt;
-  state_.orientation = state_.orientation + steering.rotation * dt;
+  state->velocity = steering.velocity;
+  state->speed = state->velocity.length();
+  state->position += state->velocity * dt;
+  state->orientation = state->orientation + steering.rotation * dt;
 
-  keepInSpeed();
-  keepInBounds();
+  keepInSpeed(state);
+  keepInBounds(state);
 
-  dd.green.pos = state_.position;
-  dd.green.v = state_.velocity;
+  dd.green.pos = state->position;
+  dd.green.v = state->velocity;
 }
 
-void Body::applySteering(const Steering& steering, const uint32_t ms) {
+void Body::applySteering(const Steering& steering, const uint32_t ms, KinematicStatus* state) {
   const float dt = ms * 0.001;
-  state_.velocity += steering.linear * dt;
-  state_.speed = state_.velocity.length();
-  keepInSpeed();
-  state_.position += state_.velocity * dt;
-  keepInBounds();
+  state->velocity += steering.linear * dt;
+  state->speed = state->velocity.length();
+  keepInSpeed(state);
+  state->position += state->velocity * dt;
+  keepInBounds(state);
 
-  state_.rotation += steering.angular * dt;
-  state_.orientation += state_.rotation * dt;
+  state->rotation += steering.angular * dt;
+  state->orientation += state->rotation * dt;
 
-  dd.green.pos = state_.position;
-  dd.green.v = state_.velocity;
+  dd.green.pos = state->position;
+  dd.green.v = state->velocity;
 }
 
-void Body::render() const {
-  sprite_.render();
-
+void Body::recordDebug() const {
   DebugDraw::drawVector(dd.red.pos, dd.red.v, 0xFF, 0x00, 0x00, 0xFF);
   DebugDraw::drawVector(dd.green.pos, dd.green.v, 0x00, 0x50, 0x00, 0xFF);
   DebugDraw::drawVector(dd.blue.pos, dd.blue.v, 0x00, 0x00, 0xFF, 0xFF);
-  DebugDraw::drawPositionHist(state_.position);
+  if (steering_mode_ == SteeringMode::Wander) {
+    DebugDraw::drawCross(dd.wander, 0x00, 0x00, 0xFF, 0xFF);
+  }
+  const Vec2 pos = kinematic_->front().position(index_);
+  switch (color_) {
+    case Color::Green: DebugDraw::drawPositionHist(this, pos, 0x00, 0x60, 0x00, 0xFF); break;
+    case Color::Blue: DebugDraw::drawPositionHist(this, pos, 0x00, 0x00, 0x90, 0xFF); break;
+    case Color::Purple: DebugDraw::drawPositionHist(this, pos, 0x60, 0x00, 0x80, 0xFF); break;
+    case Color::Red: DebugDraw::drawPositionHist(this, pos, 0x90, 0x00, 0x00, 0xFF); break;
+  }
 }
 
 void Body::setTarget(Agent* target) {
   target_ = target;
 }
 
+KinematicStatus Body::getKinematic() const {
+  return kinematic_->front().get(index_);
+}
+
+void Body::setKinematic(const KinematicStatus& status) {
+  kinematic_->set(index_, status);
+}
+
 
-void Body::updateManual(const uint32_t dt) {
+void Body::updateManual(const uint32_t dt, KinematicStatus* state) {
   float time = dt * 0.001f;             //dt comes in miliseconds
 
   MathLib::Vec2 orientation;
-  orientation.fromPolar(1.0f, state_.orientation);
-  state_.velocity = orientation.normalized() * state_.speed;
-  state_.position += state_.velocity * time;
+  orientation.fromPolar(1.0f, state->orientation);
+  state->velocity = orientation.normalized() * state->speed;
+  state->position += state->velocity * time;
 
-  keepInSpeed();
-  keepInBounds();
+  keepInSpeed(state);
+  keepInBounds(state);
 
-  dd.green.pos = state_.position;
-  dd.green.v = state_.velocity;
+  dd.green.pos = state->position;
+  dd.green.v = state->velocity;
 }
 
-void Body::setOrientation(const Vec2& velocity) {
+void Body::setOrientation(const Vec2& velocity, KinematicStatus* state) const {
   if (velocity.length2() > 0) {
-    state_.orientation = atan2(velocity.y(), velocity.x());
+    state->orientation = MathLib::atan2(velocity.y(), velocity.x());
   }
 }
 
-void Body::keepInBounds() {
-  if (state_.position.x() > WINDOW_WIDTH) state_.position.x() = 0.0f;
-  if (state_.position.x() < 0.0f) state_.position.x() = WINDOW_WIDTH;
-  if (state_.position.y() > WINDOW_HEIGHT) state_.position.y() = 0.0f;
-  if (state_.position.y() < 0.0f) state_.position.y() = WINDOW_HEIGHT;
+void Body::keepInBounds(KinematicStatus* state) const {
+  if (state->position.x() > WINDOW_WIDTH) state->position.x() = 0.0f;
+  if (state->position.x() < 0.0f) state->position.x() = WINDOW_WIDTH;
+  if (state->position.y() > WINDOW_HEIGHT) state->position.y() = 0.0f;
+  if (state->position.y() < 0.0f) state->position.y() = WINDOW_HEIGHT;
 }
 
-void Body::keepInSpeed() {
-  if (state_.velocity.length() > max_speed_) {
-    state_.velocity = state_.velocity.normalized() * max_speed_;
+void Body::keepInSpeed(KinematicStatus* state) const {
+  if (state->velocity.length() > max_speed_) {
+    state->velocity = state->velocity.normalized() * max_speed_;
   }
 }
 
@@ -190,7 +240,9 @@ void Body::kinematicSeek(const KinematicStatus& character, const KinematicStatus
 }
 
 void Body::kinematicFlee(const KinematicStatus& character, const KinematicStatus* target, KinematicSteering* steering) const{
-  steering->velocity = (character.position - target->position).normalized() * this->max_speed_;
+  //standing on the target there is no direction to flee in, like the batched kernels
+  const MathLib::Vec2 dir = character.position - target->position;
+  steering->velocity = (dir.length2() > 0) ? dir.normalized() * this->max_speed_ : MathLib::Vec2(0.0f, 0.0f);
   steering->rotation = 0.0f;
 }
 
@@ -215,37 +267,32 @@ void Body::kinematicWandering(const KinematicStatus& character, const KinematicS
   MathLib::Vec2 orientation;
   orientation.fromPolar(1.0f, character.orientation);
   steering->velocity = orientation * _maxSpeed;
-  steering->rotation = _maxRotation * (randomFloat(0.0f, 1.0f) - randomFloat(0.0f, 1.0f));
+  steering->rotation = _maxRotation * (rng_.nextFloat() - rng_.nextFloat());
 }
 
 void Body::seek(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const {
-  constexpr float _maxAcceleration = 100.0f;
-  steering->linear = (target->position - character.position).normalized() * _maxAcceleration;
+  steering->linear = (target->position - character.position).normalized() * MAX_ACCELERATION;
   steering->angular = 0.0f;
 }
 
 void Body::flee(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const {
-  constexpr float _maxAcceleration = 100.0f;
-  steering->linear = (character.position - target->position).normalized() * _maxAcceleration;
+  const MathLib::Vec2 dir = character.position - target->position;
+  steering->linear = (dir.length2() > 0) ? dir.normalized() * MAX_ACCELERATION : MathLib::Vec2(0.0f, 0.0f);
   steering->angular = 0.0f;
 }
 
 void Body::arrive(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const {
-  constexpr float _maxAcceleration = 100.0f;
-  constexpr float _slowRadius = 150.0f;
-  constexpr float _timeToTarget = 0.5f;
-  
   const MathLib::Vec2 dir = target->position - character.position;
   const float distance = dir.length();
   float targetSpeed = max_speed_;
-  if (distance < _slowRadius) {
-    targetSpeed *= distance / _slowRadius;
+  if (distance < ARRIVE_SLOW_RADIUS) {
+    targetSpeed *= distance / ARRIVE_SLOW_RADIUS;
   }
 
   const MathLib::Vec2 targetVelocity = dir.normalized() * targetSpeed;
-  steering->linear = (targetVelocity - character.velocity) / _timeToTarget;
-  if (steering->linear.length() > _maxAcceleration) { 
-    steering->linear = steering->linear.normalized() * _maxAcceleration;
+  steering->linear = (targetVelocity - character.velocity) / ARRIVE_TIME_TO_TARGET;
+  if (steering->linear.length() > MAX_ACCELERATION) { 
+    steering->linear = steering->linear.normalized() * MAX_ACCELERATION;
   }
   steering->angular = 0;
 }
@@ -302,7 +349,7 @@ void Body::face(const KinematicStatus& character, const KinematicStatus* target,
   const MathLib::Vec2 dir = target->position - character.position;
 
   KinematicStatus _newTarget = *target;
-  _newTarget.orientation = atan2(dir.y(), dir.x());
+  _newTarget.orientation = MathLib::atan2(dir.y(), dir.x());
   this->align(character, &_newTarget, steering);
 }
 
@@ -313,23 +360,22 @@ void Body::lookGoing(const KinematicStatus& character, const KinematicStatus* ta
   }
 
   KinematicStatus _newTarget = *target;
-  _newTarget.orientation = atan2(character.velocity.y(), character.velocity.x());
+  _newTarget.orientation = MathLib::atan2(character.velocity.y(), character.velocity.x());
   this->align(character, &_newTarget, steering);
 }
 
 
-void Body::wander(const KinematicStatus& character, const KinematicStatus* target, Steering* steering) const {
-  static float _wanderOffset = 50.0f;
-  static float _wanderRadius = 20.0f;
-  static float _wanderRate = 2.0f;
-  static float _wanderOrientation = 0;
-  static float _maxAcceleration = 100.0f;
+void Body::wander(const KinematicStatus& character, const KinematicStatus* target, Steering* steering, float* wander_orientation) const {
+  const float _wanderOffset = 50.0f;
+  const float _wanderRadius = 20.0f;
+  const float _wanderRate = 2.0f;
+  const float _maxAcceleration = 100.0f;
 
   KinematicStatus _newTarget;
 
-  _wanderOrientation += _wanderRate * (randomFloat(0, 1.0f) - randomFloat(0, 1.0f));
+  *wander_orientation += _wanderRate * (rng_.nextFloat() - rng_.nextFloat());
 
-  _newTarget.orientation = _wanderOrientation + character.orientation;
+  _newTarget.orientation = *wander_orientation + character.orientation;
   MathLib::Vec2 charOrientation;
   charOrientation.fromPolar(1.0f, character.orientation);
 
@@ -337,31 +383,31 @@ void Body::wander(const KinematicStatus& character, const KinematicStatus* targe
   targetOrientation.fromPolar(1.0f, _newTarget.orientation);
   _newTarget.position = character.position + (charOrientation * _wanderOffset);
   _newTarget.position += targetOrientation * _wanderRadius;
-  DebugDraw::drawCross(_newTarget.position, 0x00, 0x00, 0xFF, 0xFF);
+  dd.wander = _newTarget.position;
 
   this->face(character, &_newTarget, steering);
   steering->linear = charOrientation * _maxAcceleration;
 }
 
 void Body::separation(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const {
-  const float _radius = 100.0f;
+  const float _radius = NEIGHBOUR_RADIUS;
   const float _maxAcc = 100.0f;
 
   steering->linear = MathLib::Vec2(0, 0);
-  for (int i = 0; i < N_AGENTS; i++) {
-    const auto obs = agentGroup->getAgent(i)->getKinematic();
-    const auto _dir = character.position - obs->position;
-    const float _dist = _dir.length();
-    if (_dist < _radius) {
-      if (_dist == 0) {
+  const KinematicStore& kinematic = agentGroup->kinematics();
+  agentGroup->forEachCandidate(character.position, _radius, [&](const uint32_t i) {
+    const auto _dir = character.position - kinematic.position(i);
+    if (_dir.withinRadius(_radius)) {
+      if (_dir.length2() == 0) {
         MathLib::Vec2 d;
-        d.fromPolar(_radius, randomFloat(0, 3.14f));
+        d.fromPolar(_radius, rng_.range(0, 3.14f));
         steering->linear += d;
       } else {
-        steering->linear += _dir.normalized() * (_radius - _dist);
+        const float _dist = _dir.length();
+        steering->linear += (_dir / _dist) * (_radius - _dist);
       }
     }
-  }
+  });
 
   if (steering->linear.length() > _maxAcc) {
     steering->linear = steering->linear.normalized() * _maxAcc;
@@ -369,23 +415,22 @@ void Body::separation(const KinematicStatus& character, AgentGroup* agentGroup,
 }
 
 void Body::cohesion(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const {
-  const float _radius = 100.0f;
+  const float _radius = NEIGHBOUR_RADIUS;
 
   KinematicStatus st;
 
   st.position = MathLib::Vec2(0, 0);
   int total = 0;
-  for (int i = 0; i < N_AGENTS; i++) {
-    const auto obs = agentGroup->getAgent(i)->getKinematic();
-    const auto _dir = obs->position - character.position;
-    const float _dist = _dir.length();
-    if (_dist < _radius) {
-      if (_dist != 0) {
+  const KinematicStore& kinematic = agentGroup->kinematics();
+  agentGroup->forEachCandidate(character.position, _radius, [&](const uint32_t i) {
+    const auto _dir = kinematic.position(i) - character.position;
+    if (_dir.withinRadius(_radius)) {
+      if (_dir.length2() != 0) {
         st.position += _dir;
         total += 1;
       }
     }
-  }
+  });
 
   if (total) {
     st.position /= total;
@@ -395,22 +440,21 @@ void Body::cohesion(const KinematicStatus& character, AgentGroup* agentGroup, St
 }
 
 void Body::alignment(const KinematicStatus& character, AgentGroup* agentGroup, Steering* steering) const {
-  const float _radius = 100.0f;
+  const float _radius = NEIGHBOUR_RADIUS;
   const float _maxAng = 1.0f;
 
   int total = 0;
   KinematicStatus st;
 
-  for (int i = 0; i < N_AGENTS; i++) {
-    const auto obs = agentGroup->getAgent(i)->getKinematic();
-    const auto _dir = obs->position - character.position;
-    const float _dist = _dir.length();
-    if (_dist < _radius) {
-      auto _ang = wrapAnglePI(obs->orientation - character.orientation);
+  const KinematicStore& kinematic = agentGroup->kinematics();
+  agentGroup->forEachCandidate(character.position, _radius, [&](const uint32_t i) {
+    const auto _dir = kinematic.position(i) - character.position;
+    if (_dir.withinRadius(_radius)) {
+      auto _ang = wrapAnglePI(kinematic.orientation()[i] - character.orientation);
       st.orientation += _ang;
       total += 1;
     }
-  }
+  });
 
 
   if (total) {
@@ -420,14 +464,62 @@ void Body::alignment(const KinematicStatus& character, AgentGroup* agentGroup, S
   }
 }
 
+void Body::flockTerms(const KinematicStatus& character, AgentGroup* agentGroup, FlockTerms* terms) const {
+  const float _radius = NEIGHBOUR_RADIUS;
+
+  terms->separation = MathLib::Vec2(0, 0);
+  terms->cohesion = MathLib::Vec2(0, 0);
+  const KinematicStore& kinematic = agentGroup->kinematics();
+  agentGroup->forEachCandidate(character.position, _radius, [&](const uint32_t i) {
+    const auto _dir = kinematic.position(i) - character.position;
+    if (_dir.withinRadius(_radius)) {
+      if (_dir.length2() == 0) {
+        MathLib::Vec2 d;
+        d.fromPolar(_radius, rng_.range(0, 3.14f));
+        terms->separation += d;
+      } else {
+        //sqrt only for the neighbours that passed the squared radius test
+        const float _dist = _dir.length();
+        terms->separation += (-_dir / _dist) * (_radius - _dist);
+        terms->cohesion += _dir;
+        terms->cohesion_total += 1;
+      }
+      terms->alignment += wrapAnglePI(kinematic.orientation()[i] - character.orientation);
+      terms->alignment_total += 1;
+    }
+  });
+}
+
 void Body::flocking(const KinematicStatus& character, AgentGroup* agentGroup,const KinematicStatus * target ,Steering* steering) const {
-  Steering seek, align, cohesion, separation, face;
+  const float _maxAcc = 100.0f;
+
+  Steering seek, align, cohesion, face;
   this->seek(character, target, &seek);
   this->face(character, target, &face);
-  this->alignment(character, agentGroup, &align);
-  this->separation(character, agentGroup, &separation);
-  this->cohesion(character, agentGroup, &cohesion);
 
-  steering->linear = seek.linear * 0.6f + separation.linear * 0.3f + cohesion.linear * 0.1f;
+  //one neighbour scan feeds the three group behaviours
+  FlockTerms terms;
+  this->flockTerms(character, agentGroup, &terms);
+
+  if (terms.alignment_total) {
+    KinematicStatus st;
+    st.orientation = terms.alignment / terms.alignment_total;
+    st.orientation += character.orientation;
+    this->align(character, &st, &align);
+  }
+
+  if (terms.separation.length() > _maxAcc) {
+    terms.separation = terms.separation.normalized() * _maxAcc;
+  }
+
+  if (terms.cohesion_total) {
+    KinematicStatus st;
+    st.position = terms.cohesion;
+    st.position /= terms.cohesion_total;
+    st.position += character.position;
+    this->arrive(character, &st, &cohesion);
+  }
+
+  steering->linear = seek.linear * 0.6f + terms.separation * 0.3f + cohesion.linear * 0.1f;
   steering->angular = face.angular * 0.7f + align.angular * 0.3f;
 }
@@ -8,100 +8,207 @@
 #include <debug_draw.h>
 #include <window.h>
 #include <defines.h>
+#include <profiler.h>
 
-float DebugDraw::delta_ = 0.01f;
-bool DebugDraw::enabled_ = false;
-uint16_t DebugDraw::hist_idx_ = 0;
-Vec2 DebugDraw::hist_[MAX_HIST];
-std::vector<DebugDraw::Command> DebugDraw::command_list_;
+#include <algorithm>
 
-void DebugDraw::renderVector(const Vec2& pos, const Vec2& v,
-  const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a) {
-  if (enabled_) {
-    if (((v.x() > delta_) || (v.x() < -delta_)) && ((v.y() > delta_) || ((v.y() < -delta_)))) {
-      SDL_Renderer* renderer = Window::instance().getRenderer();
-      SDL_SetRenderDrawColor(renderer, r, g, b, a);
-      SDL_RenderDrawLine(renderer, pos.x(), pos.y(), pos.x() + v.x(), pos.y() + v.y());
+float DebugDraw::delta_ = 0.01f;
+std::atomic<bool> DebugDraw::enabled_{ false };
+uint16_t DebugDraw::trail_length_ = TRAIL_LENGTH;
+uint32_t DebugDraw::frame_ = 0;
+std::unordered_map<const void*, DebugDraw::Trail> DebugDraw::trails_;
+FrameArena<DebugDraw::Command> DebugDraw::commands_(DEBUG_DRAW_COMMANDS);
 
-      const Vec2 p_vertex = pos + v;
-      const Vec2 p_tmp = p_vertex - (v.normalized() * 5.0f);
+namespace {
+  typedef DebugDraw::Point LinePoint;
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+  inline LinePoint linePoint(const Vec2& p) { return LinePoint{ p.x(), p.y() }; }
+  inline void drawLines(SDL_Renderer* renderer, const LinePoint* points, const int count) {
+    SDL_RenderDrawLinesF(renderer, points, count);
+  }
+  inline void drawPoints(SDL_Renderer* renderer, const LinePoint* points, const int count) {
+    SDL_RenderDrawPointsF(renderer, points, count);
+  }
+#else
+  inline LinePoint linePoint(const Vec2& p) { return LinePoint{ (int)p.x(), (int)p.y() }; }
+  inline void drawLines(SDL_Renderer* renderer, const LinePoint* points, const int count) {
+    SDL_RenderDrawLines(renderer, points, count);
+  }
+  inline void drawPoints(SDL_Renderer* renderer, const LinePoint* points, const int count) {
+    SDL_RenderDrawPoints(renderer, points, count);
+  }
+#endif
 
-      const float pi_q = M_PI / 4.0f;
-      const Vec2 p_arrow1 = rotate2D(p_vertex, p_tmp, pi_q);
-      const Vec2 p_arrow2 = rotate2D(p_vertex, p_tmp, -pi_q);
+  std::vector<LinePoint> line_points;     //render thread only, reused every frame
 
-      SDL_RenderDrawLine(renderer, p_vertex.x(), p_vertex.y(), p_arrow1.x(), p_arrow1.y());
-      SDL_RenderDrawLine(renderer, p_vertex.x(), p_vertex.y(), p_arrow2.x(), p_arrow2.y());
+  //shaft and both arrow heads as one polyline, retracing the tip
+  bool vectorPolyline(const Vec2& pos, const Vec2& v, const float delta) {
+    if (!(((v.x() > delta) || (v.x() < -delta)) && ((v.y() > delta) || ((v.y() < -delta))))) {
+      return false;
     }
+    const Vec2 p_vertex = pos + v;
+    const Vec2 p_tmp = p_vertex - (v.normalized() * 5.0f);
+
+    const float pi_q = M_PI / 4.0f;
+    const Vec2 p_arrow1 = rotate2D(p_vertex, p_tmp, pi_q);
+    const Vec2 p_arrow2 = rotate2D(p_vertex, p_tmp, -pi_q);
+
+    line_points.push_back(linePoint(pos));
+    line_points.push_back(linePoint(p_vertex));
+    line_points.push_back(linePoint(p_arrow1));
+    line_points.push_back(linePoint(p_vertex));
+    line_points.push_back(linePoint(p_arrow2));
+    return true;
+  }
+
+  //both diagonals as one polyline, going through the center between them
+  void crossPolyline(const Vec2& pos) {
+    const float disp = 6.0f;
+    line_points.push_back(linePoint(Vec2(pos.x() + disp, pos.y() + disp)));
+    line_points.push_back(linePoint(Vec2(pos.x() - disp, pos.y() - disp)));
+    line_points.push_back(linePoint(pos));
+    line_points.push_back(linePoint(Vec2(pos.x() + disp, pos.y() - disp)));
+    line_points.push_back(linePoint(Vec2(pos.x() - disp, pos.y() + disp)));
   }
 }
 
-void DebugDraw::renderCross(const Vec2& pos,
-  const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a) {
-  if (enabled_) {
-    SDL_Renderer* renderer = Window::instance().getRenderer();
-    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+void DebugDraw::renderCommands(const Frame& frame) {
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+  const FrameArena<Command>& commands = frame.commands;
+  for (uint32_t first = 0; first < commands.size();) {
+    const Command& group = commands[first];
+    SDL_SetRenderDrawColor(renderer, group.r, group.g, group.b, group.a);
 
-    const float disp = 6.0f;
-    const Vec2 p1(pos.x() + disp, pos.y() + disp);
-    const Vec2 p2(pos.x() + disp, pos.y() - disp);
-    const Vec2 p3(pos.x() - disp, pos.y() + disp);
-    const Vec2 p4(pos.x() - disp, pos.y() - disp);
+    uint32_t last = first;
+    for (; (last < commands.size()) && (commands[last].color() == group.color()); ++last) {
+      line_points.clear();
+      const Command& command = commands[last];
+      switch (command.type) {
+        case CommandType::Vector:
+          if (!vectorPolyline(command.pos, command.dir, delta_)) continue;
+          break;
+        case CommandType::Cross:
+          crossPolyline(command.pos);
+          break;
+      }
+      drawLines(renderer, line_points.data(), (int)line_points.size());
+    }
+    first = last;
+  }
+}
 
-    SDL_RenderDrawLine(renderer, p1.x(), p1.y(), p4.x(), p4.y());
-    SDL_RenderDrawLine(renderer, p2.x(), p2.y(), p3.x(), p3.y());
+void DebugDraw::renderPositionHist(const Frame& frame) {
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+  for (const auto& bucket : frame.trails) {
+    if (bucket.points.empty()) continue;
+    SDL_SetRenderDrawColor(renderer, (bucket.color >> 24) & 0xFF, (bucket.color >> 16) & 0xFF,
+      (bucket.color >> 8) & 0xFF, bucket.color & 0xFF);
+    drawPoints(renderer, bucket.points.data(), (int)bucket.points.size());
   }
 }
 
-void DebugDraw::renderPositionHist() {
-  if (enabled_) {
-    for (uint16_t i = 0; i < MAX_HIST; ++i) {
-      SDL_Renderer* renderer = Window::instance().getRenderer();
-      SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xFF);
-      SDL_RenderDrawPoint(renderer, (uint32_t)hist_[i].x(), (uint32_t)hist_[i].y());
+void DebugDraw::captureTrails(Frame* frame) {
+  for (auto& bucket : frame->trails) {
+    bucket.points.clear();
+  }
+
+  for (auto it = trails_.begin(); it != trails_.end();) {
+    const Trail& trail = it->second;
+    if (trail.frame != frame_) {
+      it = trails_.erase(it);
+      continue;
+    }
+    auto bucket = std::find_if(frame->trails.begin(), frame->trails.end(),
+      [&trail](const TrailBucket& b) { return b.color == trail.color; });
+    if (bucket == frame->trails.end()) {
+      frame->trails.push_back(TrailBucket{ trail.color, {} });
+      bucket = frame->trails.end() - 1;
+    }
+    for (const auto& p : trail.points) {
+      bucket->points.push_back(linePoint(p));
     }
+    ++it;
   }
 }
 
 void DebugDraw::drawVector(const Vec2& pos, const Vec2& v,
   const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a) {
-  Command com;
-  com.type = CommandType::Vector;
-  com.pos = pos;
-  com.dir = v;
-  com.r = r;
-  com.g = g;
-  com.b = b;
-  com.a = a;
-  command_list_.push_back(com);
+  if (!isEnabled() || Window::instance().isHeadless()) return;
+  Command* com = commands_.alloc();
+  com->type = CommandType::Vector;
+  com->pos = pos;
+  com->dir = v;
+  com->r = r;
+  com->g = g;
+  com->b = b;
+  com->a = a;
 }
 
 void DebugDraw::drawCross(const Vec2& pos,
   const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a) {
-  Command com;
-  com.type = CommandType::Cross;
-  com.pos = pos;
-  com.dir = Vec2(0.0f, 0.0f);
-  com.r = r;
-  com.g = g;
-  com.b = b;
-  com.a = a;
-  command_list_.push_back(com);
+  if (!isEnabled() || Window::instance().isHeadless()) return;
+  Command* com = commands_.alloc();
+  com->type = CommandType::Cross;
+  com->pos = pos;
+  com->dir = Vec2(0.0f, 0.0f);
+  com->r = r;
+  com->g = g;
+  com->b = b;
+  com->a = a;
 }
 
-void DebugDraw::drawPositionHist(const Vec2& pos) {
-  hist_[hist_idx_++ % MAX_HIST] = pos;
+void DebugDraw::drawPositionHist(const void* owner, const Vec2& pos,
+  const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a) {
+  if (!isEnabled() || Window::instance().isHeadless() || (trail_length_ == 0)) return;
+  Trail& trail = trails_[owner];
+  if (trail.points.size() < trail_length_) {
+    trail.points.push_back(pos);
+  } else {
+    trail.points[trail.next] = pos;
+    trail.next = (trail.next + 1) % trail_length_;
+  }
+  trail.frame = frame_;
+  trail.color = ((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | a;
 }
 
-void DebugDraw::render() {
-  if (enabled_) {
-    for(auto& command:command_list_) {
-      switch(command.type) {
-        case CommandType::Vector: renderVector(command.pos, command.dir, command.r, command.g, command.b, command.a); break;
-        case CommandType::Cross: renderCross(command.pos, command.r, command.g, command.b, command.a); break;
-      }
+void DebugDraw::setTrailLength(const uint16_t length) {
+  trail_length_ = length;
+  trails_.clear();
+}
+
+void DebugDraw::capture(Frame* frame) {
+  PROFILE_SCOPE("DebugDraw::capture");
+  frame->commands.reset();
+  for (const auto& command : commands_) {
+    *frame->commands.alloc() = command;
+  }
+  frame->command_capacity = commands_.capacity();
+  frame->command_peak = commands_.peak();
+  frame->command_grows = commands_.grows();
+  commands_.reset();
+
+  //order inside a colour group does not change the image, so no stable sort
+  //and no temporary buffer
+  std::sort(frame->commands.begin(), frame->commands.end(),
+    [](const Command& a, const Command& b) { return a.color() < b.color(); });
+
+  if (isEnabled()) {
+    captureTrails(frame);
+  } else {
+    //trails are only fed while enabled, drop them here on the simulation thread
+    trails_.clear();
+    for (auto& bucket : frame->trails) {
+      bucket.points.clear();
     }
-    renderPositionHist();
   }
-  command_list_.clear();
+  ++frame_;
 }
+
+void DebugDraw::render(const Frame& frame) {
+  PROFILE_SCOPE("DebugDraw::render");
+  if (isEnabled() && !Window::instance().isHeadless()) {
+    renderCommands(frame);
+    renderPositionHist(frame);
+  }
+}
+
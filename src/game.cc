@@ -9,65 +9,104 @@
 #include <window.h>
 #include <defines.h>
 #include <debug_draw.h>
+#include <profiler.h>
 
 #include <cstdio>
+#include <thread>
 
-void Game::init() {
+void Game::init(const uint32_t n_agents, const uint64_t seed, InputLog* log) {
   font_ = TTF_OpenFont(FONT_FILE, FPS_FONT_SIZE);
   if (!font_) {
     printf("Failed to load font! SDL_ttf Error: %s\n", TTF_GetError());
   }
 
-  fps_sprite_.setVisible(false);
+  hud_font_.init(font_, SDL_Color FOREGROUND_COLOR, true);
+  for (uint32_t i = 0; i < 4; ++i) {
+    agent_sprites_[i].loadFromFile(Body::spritePath((Body::Color)i));
+  }
+
+  log_ = log;
+  n_agents_ = n_agents;
+  world_.init(n_agents, seed);
+
+  KinematicStatus target = world_.target()->getKinematic();
+  target.position = MathLib::Vec2(0.0f, 0.0f);
+  world_.target()->setKinematic(target);
 
-  world_.target()->getKinematic()->position = MathLib::Vec2(0.0f, 0.0f);
+  world_.snapshot(snapshots_.back());
+  snapshots_.publish();
 }
 
 void Game::start() {
   uint32_t fps_time{ 0 };
   uint32_t fps_time_acc{ 0 };
 
-  uint32_t next_game_tick = SDL_GetTicks();
-  uint32_t update_loops = 0;
   uint32_t render_loops = 0;
+  uint64_t profile_since = Profiler::now();
 
-  const uint32_t skip_ticks = 1000 / TICKS_PER_SECOND;
-
+  std::thread simulation(&Game::simulate, this);
   while (!quit_) {
-    uint32_t loops = 0;
-    while ((SDL_GetTicks() > next_game_tick) && (loops < MAX_FRAME_SKIP)) {
-      handleInput();
-      update(skip_ticks);
-
-      next_game_tick += skip_ticks;
-      ++loops;
-      ++update_loops;
-    }
-
-    render();
+    handleInput();
+    render(*snapshots_.acquire());
 
     uint32_t c_time = SDL_GetTicks();
     fps_time_acc += (c_time - fps_time);
     fps_time = c_time;
     ++render_loops;
     if (render_loops > 100) {        //show stats each 100 frames
+      const uint32_t update_loops = update_loops_.exchange(0);
+      const uint64_t update_counter = update_counter_.exchange(0);
       const float fps = 1000.0f / (fps_time_acc / 100.0f);
       const float ratio = (float)render_loops / (float)update_loops;
-      char text[255];
-      sprintf_s(text, "%d RFPS      %d UFPS", (uint32_t)fps, (uint32_t)(fps / ratio));
-      fps_sprite_.loadFromRenderedText(text, SDL_Color FOREGROUND_COLOR, font_, true);
-      fps_sprite_.setVisible(true);
+      const double tick_ms = (update_loops > 0) ?
+        ((update_counter * 1000.0) / ((double)SDL_GetPerformanceFrequency() * update_loops)) : 0.0;
+      const int used = sprintf_s(hud_text_, "%d RFPS      %d UFPS\n%u agents\n%.2f ms tick\n\n", (uint32_t)fps,
+        (uint32_t)(fps / ratio), n_agents_, tick_ms);
+      if (Profiler::instance().isEnabled() && (used > 0) && ((size_t)used < sizeof(hud_text_))) {
+        Profiler::instance().summary(profile_since, render_loops, hud_text_ + used, sizeof(hud_text_) - used);
+      }
+      profile_since = Profiler::now();
 
       render_loops = 0;
-      update_loops = 0;
       fps_time_acc = 0;
     }
   }
+  simulation.join();
+}
+
+void Game::simulate() {
+  uint32_t next_game_tick = SDL_GetTicks();
+  while (!quit_) {
+    uint32_t loops = 0;
+    while ((SDL_GetTicks() > next_game_tick) && (loops < MAX_FRAME_SKIP)) {
+      const uint64_t update_start = SDL_GetPerformanceCounter();
+      update();
+      update_counter_ += SDL_GetPerformanceCounter() - update_start;
+
+      next_game_tick += TICK_MS * slo_mo_;
+      ++loops;
+      ++update_loops_;
+    }
+
+    if (loops > 0) {
+      Snapshot* snapshot = snapshots_.back();
+      world_.snapshot(snapshot);
+      snapshot->next_tick_time = next_game_tick;
+      snapshot->tick_ms = TICK_MS * slo_mo_;
+      snapshots_.publish();
+    }
+
+    const uint32_t c_time = SDL_GetTicks();
+    if (next_game_tick >= c_time) {
+      SDL_Delay(next_game_tick - c_time + 1);
+    }
+  }
 }
 
 void Game::shutdown() {}
 
 void Game::handleInput() {
+  PROFILE_SCOPE("Game::handleInput");
   SDL_Event e;
   while (SDL_PollEvent(&e) != 0) {
     if (e.type == SDL_QUIT) {
@@ -78,8 +117,7 @@ void Game::handleInput() {
       if (e.type == SDL_MOUSEBUTTONUP) {
         int x, y;
         SDL_GetMouseState(&x, &y);
-
-        world_.target()->getKinematic()->position = Vec2(x, y);
+        queue(Command::Type::TargetPosition, (float)x, (float)y);
       }
     }
 
@@ -89,122 +127,140 @@ void Game::handleInput() {
 			quit_ = true; 
 			break;
         case SDLK_F3:
-          slo_mo_ = clamp<int8_t>(++slo_mo_, 1, 10);
-          printf("Slow Motion Set To %d\n", slo_mo_);
+          slo_mo_ = clamp<int8_t>(slo_mo_ + 1, 1, 10);
+          printf("Slow Motion Set To %d\n", (int)slo_mo_);
         break;
         case SDLK_F4:
-          slo_mo_ = clamp<int8_t>(--slo_mo_, 1, 10);
-          printf("Slow Motion Set To %d\n", slo_mo_);
+          slo_mo_ = clamp<int8_t>(slo_mo_ - 1, 1, 10);
+          printf("Slow Motion Set To %d\n", (int)slo_mo_);
         break;
         case SDLK_F5:
           DebugDraw::toggleEnabled();
-          printf("Debug Draw Mode Changed\n");
+          report_debug_stats_ = true;
+        break;
+        case SDLK_F6:
+          Profiler::instance().writeChromeTrace(PROFILE_FILE);
+        break;
+        case SDLK_F7:
+          Profiler::instance().setEnabled(!Profiler::instance().isEnabled());
+          printf("Profiler %s\n", Profiler::instance().isEnabled() ? "Recording" : "Paused");
         break;
-        case SDLK_UP: {
-          world_.target()->getKinematic()->speed += 20.0f;
-          if (world_.target()->getKinematic()->speed > 140.0f) {
-            world_.target()->getKinematic()->speed = 140.0f;
-          }
-          break; }
-        case SDLK_DOWN: {
-          world_.target()->getKinematic()->speed -= 20.0f;
-          if (world_.target()->getKinematic()->speed <= 0.0f) {
-            world_.target()->getKinematic()->speed = 0.0f;
-          }
-          break; }
-        case SDLK_LEFT: {
-          world_.target()->getKinematic()->orientation -= 0.2f;
-          break;
-        }
-        case SDLK_RIGHT: {
-          world_.target()->getKinematic()->orientation += 0.2f;
-          break;
-        }
+        case SDLK_UP:
+          queue(Command::Type::TargetSpeed, 20.0f);
+          break;
+        case SDLK_DOWN:
+          queue(Command::Type::TargetSpeed, -20.0f);
+          break;
+        case SDLK_LEFT:
+          queue(Command::Type::TargetOrientation, -0.2f);
+          break;
+        case SDLK_RIGHT:
+          queue(Command::Type::TargetOrientation, 0.2f);
+          break;
         case SDLK_1:
-          world_.ia()->setSteering(Body::SteeringMode::Kinematic_Seek);
-          printf("Behavior Of Agent Changed To Kinematic_Seek\n");
+          queueSteering(Body::SteeringMode::Kinematic_Seek, "Kinematic_Seek");
           break;
         case SDLK_2:
-          world_.ia()->setSteering(Body::SteeringMode::Kinematic_Flee);
-          printf("Behavior Of Agent Changed To Kinematic_Flee\n");
+          queueSteering(Body::SteeringMode::Kinematic_Flee, "Kinematic_Flee");
           break;
         case SDLK_3:
-          world_.ia()->setSteering(Body::SteeringMode::Kinematic_Arrive);
-          printf("Behavior Of Agent Changed To Kinematic_Arrive\n");
+          queueSteering(Body::SteeringMode::Kinematic_Arrive, "Kinematic_Arrive");
           break;
         case SDLK_4:
-          world_.ia()->setSteering(Body::SteeringMode::Kinematic_Wander);
-          printf("Behavior Of Agent Changed To Kinematic_Wander\n");
+          queueSteering(Body::SteeringMode::Kinematic_Wander, "Kinematic_Wander");
           break;
         case SDLK_q:
-          world_.ia()->setSteering(Body::SteeringMode::Seek);
-          printf("Behavior Of Agent Changed To Seek\n");
+          queueSteering(Body::SteeringMode::Seek, "Seek");
           break;
         case SDLK_w:
-          world_.ia()->setSteering(Body::SteeringMode::Flee);
-          printf("Behavior Of Agent Changed To Flee\n");
+          queueSteering(Body::SteeringMode::Flee, "Flee");
           break;
         case SDLK_e:
-          world_.ia()->setSteering(Body::SteeringMode::Arrive);
-          printf("Behavior Of Agent Changed To Arrive\n");
+          queueSteering(Body::SteeringMode::Arrive, "Arrive");
           break;
         case SDLK_r:
-          world_.ia()->setSteering(Body::SteeringMode::Align);
-          printf("Behavior Of Agent Changed To Align\n");
+          queueSteering(Body::SteeringMode::Align, "Align");
           break;
         case SDLK_t:
-          world_.ia()->setSteering(Body::SteeringMode::Velocity_Matching);
-          printf("Behavior Of Agent Changed To Velocity_Matching\n");
+          queueSteering(Body::SteeringMode::Velocity_Matching, "Velocity_Matching");
           break;
         case SDLK_a:
-          world_.ia()->setSteering(Body::SteeringMode::Pursue);
-          printf("Behavior Of Agent Changed To Pursue\n");
+          queueSteering(Body::SteeringMode::Pursue, "Pursue");
           break;
         case SDLK_s:
-          world_.ia()->setSteering(Body::SteeringMode::Face);
-          printf("Behavior Of Agent Changed To Face\n");
+          queueSteering(Body::SteeringMode::Face, "Face");
           break;
         case SDLK_d:
-          world_.ia()->setSteering(Body::SteeringMode::LookGoing);
-          printf("Behavior Of Agent Changed To LookGoing\n");
+          queueSteering(Body::SteeringMode::LookGoing, "LookGoing");
           break;
         case SDLK_f:
-          world_.ia()->setSteering(Body::SteeringMode::Wander);
-          printf("Behavior Of Agent Changed To Wander\n");
+          queueSteering(Body::SteeringMode::Wander, "Wander");
           break;
         case SDLK_z:
-          world_.ia()->setSteering(Body::SteeringMode::Separation);
-          printf("Behavior Of Agent Changed To Separation\n");
+          queueSteering(Body::SteeringMode::Separation, "Separation");
           break;
         case SDLK_x:
-          world_.ia()->setSteering(Body::SteeringMode::Cohesion);
-          printf("Behavior Of Agent Changed To Cohesion\n");
+          queueSteering(Body::SteeringMode::Cohesion, "Cohesion");
           break;
         case SDLK_c:
-          world_.ia()->setSteering(Body::SteeringMode::Alignment);
-          printf("Behavior Of Agent Changed To Alignment\n");
+          queueSteering(Body::SteeringMode::Alignment, "Alignment");
           break;
         case SDLK_v:
-          world_.ia()->setSteering(Body::SteeringMode::Flocking);
-          printf("Behavior Of Agent Changed To Flocking\n");
+          queueSteering(Body::SteeringMode::Flocking, "Flocking");
           break;
       }
     }
   }
 }
 
-void Game::update(const uint32_t dt) {
-  world_.update(dt / slo_mo_);
+void Game::update() {
+  {
+    std::lock_guard<std::mutex> lock(commands_mutex_);
+    tick_commands_.swap(commands_);
+  }
+  log_->process(world_.tick(), &tick_commands_);
+  world_.step(tick_commands_);
+  tick_commands_.clear();
+}
+
+void Game::queue(const Command::Type type, const float x, const float y, const int32_t mode) {
+  Command command;
+  command.type = type;
+  command.x = x;
+  command.y = y;
+  command.mode = mode;
+  std::lock_guard<std::mutex> lock(commands_mutex_);
+  commands_.push_back(command);
 }
 
-void Game::render() {
+void Game::queueSteering(const Body::SteeringMode mode, const char* name) {
+  queue(Command::Type::Steering, 0.0f, 0.0f, (int32_t)mode);
+  printf("Behavior Of Agent Changed To %s\n", name);
+}
+
+void Game::render(const Snapshot& snapshot) {
+  PROFILE_SCOPE("Game::render");
+  if (report_debug_stats_) {
+    report_debug_stats_ = false;
+    printf("Debug Draw Mode Changed, commands peak %u of %u, %u grows\n",
+      snapshot.debug.command_peak, snapshot.debug.command_capacity, snapshot.debug.command_grows);
+  }
   SDL_Renderer* renderer = Window::instance().getRenderer();
   SDL_SetRenderDrawColor(renderer, 0xD0, 0xD0, 0xD0, 0xFF);
   SDL_RenderClear(renderer);
 
-  fps_sprite_.render();
-  world_.render();
-  DebugDraw::render();
+  hud_font_.render(hud_text_, 0, 0);
+  //agents are drawn between the last two ticks, so motion stays smooth above the tick rate
+  const float alpha = snapshot.alpha(SDL_GetTicks());
+  for (const auto& group : snapshot.groups) {
+    const Sprite& sprite = agent_sprites_[(uint32_t)group.color];
+    for (uint32_t i = 0; i < group.agents.size(); ++i) {
+      const Snapshot::Transform agent = snapshot.blend(group, i, alpha);
+      sprite.render(&batch_, agent.x, agent.y, agent.orientation);
+    }
+  }
+  batch_.flush();
+  DebugDraw::render(snapshot.debug);
 
   SDL_RenderPresent(renderer);
 }
\ No newline at end of file
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <glyph_atlas.h>
+#include <window.h>
+#include <defines.h>
+
+#include <cstdio>
+
+bool GlyphAtlas::init(TTF_Font* font, const SDL_Color& color, const bool shadow) {
+  free();
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+  if (!renderer || !font) return false;
+
+  int shadowOffset = 0;
+  if (shadow) {
+    shadowOffset = (TTF_FontHeight(font) > 40) ? 2 : 1;
+  }
+
+  //glyphs are laid out in a single row, each cell wide enough for its shadow
+  SDL_Surface* glyph_surfaces[GLYPH_LAST - GLYPH_FIRST + 1] = {};
+  width_ = 0;
+  height_ = TTF_FontHeight(font) + shadowOffset;
+  for (int c = GLYPH_FIRST; c <= GLYPH_LAST; ++c) {
+    Glyph& glyph = glyphs_[c - GLYPH_FIRST];
+    glyph.src = SDL_Rect{ width_, 0, 0, 0 };
+    if (TTF_GlyphMetrics(font, (Uint16)c, nullptr, nullptr, nullptr, nullptr, &glyph.advance) != 0) {
+      glyph.advance = 0;
+    }
+    SDL_Surface* surface = TTF_RenderGlyph_Blended(font, (Uint16)c, color);
+    if (!surface) continue;
+    glyph_surfaces[c - GLYPH_FIRST] = surface;
+    glyph.src.w = surface->w + shadowOffset;
+    glyph.src.h = surface->h + shadowOffset;
+    width_ += glyph.src.w;
+    if (glyph.src.h > height_) height_ = glyph.src.h;
+  }
+  line_height_ = TTF_FontLineSkip(font);
+
+  SDL_Surface* atlas = nullptr;
+  if (width_ > 0) {
+    atlas = SDL_CreateRGBSurfaceWithFormat(0, width_, height_, 32, SDL_PIXELFORMAT_RGBA32);
+  }
+  if (atlas) {
+    for (int c = GLYPH_FIRST; c <= GLYPH_LAST; ++c) {
+      SDL_Surface* surface = glyph_surfaces[c - GLYPH_FIRST];
+      if (!surface) continue;
+      const SDL_Rect& src = glyphs_[c - GLYPH_FIRST].src;
+      SDL_Rect r_dst;
+      if (shadow) {
+        SDL_Surface* shadowS = TTF_RenderGlyph_Blended(font, (Uint16)c, SDL_Color SHADOW_COLOR);
+        if (shadowS) {
+          r_dst.x = src.x + shadowOffset; r_dst.y = shadowOffset; r_dst.w = shadowS->w; r_dst.h = shadowS->h;
+          SDL_BlitSurface(shadowS, &shadowS->clip_rect, atlas, &r_dst);
+          SDL_FreeSurface(shadowS);
+        }
+      }
+      r_dst.x = src.x; r_dst.y = 0; r_dst.w = surface->w; r_dst.h = surface->h;
+      SDL_BlitSurface(surface, &surface->clip_rect, atlas, &r_dst);
+    }
+    texture_ = SDL_CreateTextureFromSurface(renderer, atlas);
+    if (!texture_) {
+      printf("Unable to create glyph atlas texture! SDL Error: %s\n", SDL_GetError());
+    }
+    SDL_FreeSurface(atlas);
+  } else {
+    printf("Unable to create glyph atlas surface! SDL Error: %s\n", SDL_GetError());
+  }
+
+  for (auto surface : glyph_surfaces) {
+    if (surface) SDL_FreeSurface(surface);
+  }
+  return texture_ != nullptr;
+}
+
+void GlyphAtlas::free() {
+  if (texture_) {
+    SDL_DestroyTexture(texture_);
+    texture_ = nullptr;
+  }
+}
+
+void GlyphAtlas::render(const char* text, const int x, const int y) const {
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+  if (!texture_ || !renderer) return;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  vertices_.clear();
+  indices_.clear();
+  const SDL_Color white = { 0xFF, 0xFF, 0xFF, 0xFF };
+#endif
+  const Glyph& space = glyphs_[' ' - GLYPH_FIRST];
+  int pen_x = x;
+  int pen_y = y;
+  for (const char* c = text; *c; ++c) {
+    if (*c == '\n') {
+      pen_x = x;
+      pen_y += line_height_;
+      continue;
+    }
+    const bool in_atlas = (*c >= GLYPH_FIRST) && (*c <= GLYPH_LAST);
+    const Glyph& glyph = in_atlas ? glyphs_[*c - GLYPH_FIRST] : space;
+    if (in_atlas && (glyph.src.w > 0)) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      const int base = (int)vertices_.size();
+      const float u0 = (float)glyph.src.x / width_;
+      const float u1 = (float)(glyph.src.x + glyph.src.w) / width_;
+      const float v1 = (float)glyph.src.h / height_;
+      const float px[4] = { (float)pen_x, (float)(pen_x + glyph.src.w), (float)(pen_x + glyph.src.w), (float)pen_x };
+      const float py[4] = { (float)pen_y, (float)pen_y, (float)(pen_y + glyph.src.h), (float)(pen_y + glyph.src.h) };
+      const float u[4] = { u0, u1, u1, u0 };
+      const float v[4] = { 0.0f, 0.0f, v1, v1 };
+      for (int k = 0; k < 4; ++k) {
+        SDL_Vertex vertex;
+        vertex.position.x = px[k];
+        vertex.position.y = py[k];
+        vertex.color = white;
+        vertex.tex_coord.x = u[k];
+        vertex.tex_coord.y = v[k];
+        vertices_.push_back(vertex);
+      }
+      const int quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+      for (const int i : quad_indices) {
+        indices_.push_back(base + i);
+      }
+#else
+      const SDL_Rect dst = { pen_x, pen_y, glyph.src.w, glyph.src.h };
+      SDL_RenderCopy(renderer, texture_, &glyph.src, &dst);
+#endif
+    }
+    pen_x += glyph.advance;
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  if (!vertices_.empty()) {
+    SDL_RenderGeometry(renderer, texture_, vertices_.data(), (int)vertices_.size(),
+      indices_.data(), (int)indices_.size());
+  }
+#endif
+}
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <input_log.h>
+#include <body.h>
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+//text format, one command per line after the header:
+//  seed <seed> agents <n>
+//  <tick> <type> <x> <y> <mode>
+//floats are written with 9 digits so they read back to the same bits
+
+bool InputLog::record(const char* path, const uint64_t seed, const uint32_t n_agents) {
+  close();
+  out_.open(path);
+  if (!out_) {
+    printf("Failed to open input log %s for writing\n", path);
+    return false;
+  }
+  seed_ = seed;
+  n_agents_ = n_agents;
+  out_ << "seed " << seed << " agents " << n_agents << "\n";
+  out_ << std::setprecision(9);
+  return true;
+}
+
+bool InputLog::replay(const char* path) {
+  close();
+  std::ifstream in(path);
+  std::string seed_tag, agents_tag;
+  if (!(in >> seed_tag >> seed_ >> agents_tag >> n_agents_) || (seed_tag != "seed") || (agents_tag != "agents")) {
+    printf("Failed to read input log %s\n", path);
+    return false;
+  }
+
+  //a bad line is reported and skipped, an out of range type or mode would
+  //index past the tables that World::apply and Body dispatch through
+  std::string line;
+  std::getline(in, line);
+  for (uint32_t line_number = 2; std::getline(in, line); ++line_number) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    std::istringstream fields(line);
+    Command command;
+    uint32_t type;
+    if (!(fields >> command.tick >> type >> command.x >> command.y >> command.mode)) {
+      printf("Input log %s:%u: malformed command, skipped\n", path, line_number);
+      continue;
+    }
+    if (type > (uint32_t)Command::Type::Steering) {
+      printf("Input log %s:%u: unknown command type %u, skipped\n", path, line_number, type);
+      continue;
+    }
+    command.type = (Command::Type)type;
+    if ((command.type == Command::Type::Steering) &&
+        ((command.mode < 0) || ((uint32_t)command.mode >= Body::steering_modes_))) {
+      printf("Input log %s:%u: unknown steering mode %d, skipped\n", path, line_number, command.mode);
+      continue;
+    }
+    replay_.push_back(command);
+  }
+  replaying_ = true;
+  printf("Replaying %u commands from %s\n", (uint32_t)replay_.size(), path);
+  return true;
+}
+
+void InputLog::close() {
+  if (out_.is_open()) {
+    out_.close();
+  }
+  replay_.clear();
+  next_ = 0;
+  replaying_ = false;
+}
+
+void InputLog::process(const uint32_t tick, std::vector<Command>* commands) {
+  if (replaying_) {
+    commands->clear();
+    while ((next_ < replay_.size()) && (replay_[next_].tick <= tick)) {
+      commands->push_back(replay_[next_++]);
+    }
+    return;
+  }
+
+  for (auto& command : *commands) {
+    command.tick = tick;
+    if (out_.is_open()) {
+      out_ << command.tick << " " << (uint32_t)command.type << " "
+           << command.x << " " << command.y << " " << command.mode << "\n";
+    }
+  }
+}
@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <kinematic_store.h>
+
+#include <cstring>
+
+namespace {
+  uint64_t hashFloats(uint64_t h, const std::vector<float>& values) {
+    for (const float value : values) {
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      for (uint32_t b = 0; b < 4; ++b) {
+        h ^= (bits >> (b * 8)) & 0xFF;
+        h *= 1099511628211ULL;
+      }
+    }
+    return h;
+  }
+}
+
+uint32_t KinematicStore::add(const KinematicStatus& status) {
+  const uint32_t i = size();
+  pos_x_.push_back(status.position.x());
+  pos_y_.push_back(status.position.y());
+  vel_x_.push_back(status.velocity.x());
+  vel_y_.push_back(status.velocity.y());
+  orientation_.push_back(status.orientation);
+  rotation_.push_back(status.rotation);
+  speed_.push_back(status.speed);
+  wander_.push_back(status.wander);
+  return i;
+}
+
+void KinematicStore::remove(const uint32_t i) {
+  const uint32_t last = size() - 1;
+  if (i != last) {
+    set(i, get(last));
+  }
+  pos_x_.pop_back();
+  pos_y_.pop_back();
+  vel_x_.pop_back();
+  vel_y_.pop_back();
+  orientation_.pop_back();
+  rotation_.pop_back();
+  speed_.pop_back();
+  wander_.pop_back();
+}
+
+void KinematicStore::reserve(const uint32_t count) {
+  pos_x_.reserve(count);
+  pos_y_.reserve(count);
+  vel_x_.reserve(count);
+  vel_y_.reserve(count);
+  orientation_.reserve(count);
+  rotation_.reserve(count);
+  speed_.reserve(count);
+  wander_.reserve(count);
+}
+
+void KinematicStore::clear() {
+  pos_x_.clear();
+  pos_y_.clear();
+  vel_x_.clear();
+  vel_y_.clear();
+  orientation_.clear();
+  rotation_.clear();
+  speed_.clear();
+  wander_.clear();
+}
+
+KinematicStatus KinematicStore::get(const uint32_t i) const {
+  KinematicStatus status;
+  status.position = MathLib::Vec2(pos_x_[i], pos_y_[i]);
+  status.orientation = orientation_[i];
+  status.velocity = MathLib::Vec2(vel_x_[i], vel_y_[i]);
+  status.rotation = rotation_[i];
+  status.speed = speed_[i];
+  status.wander = wander_[i];
+  return status;
+}
+
+void KinematicStore::set(const uint32_t i, const KinematicStatus& status) {
+  pos_x_[i] = status.position.x();
+  pos_y_[i] = status.position.y();
+  orientation_[i] = status.orientation;
+  vel_x_[i] = status.velocity.x();
+  vel_y_[i] = status.velocity.y();
+  rotation_[i] = status.rotation;
+  speed_[i] = status.speed;
+  wander_[i] = status.wander;
+}
+
+uint64_t KinematicStore::hash(uint64_t h) const {
+  h = hashFloats(h, pos_x_);
+  h = hashFloats(h, pos_y_);
+  h = hashFloats(h, vel_x_);
+  h = hashFloats(h, vel_y_);
+  h = hashFloats(h, orientation_);
+  h = hashFloats(h, rotation_);
+  h = hashFloats(h, speed_);
+  return hashFloats(h, wander_);
+}
+
+uint32_t KinematicBuffer::add(const KinematicStatus& status) {
+  store_[1].add(status);
+  return store_[0].add(status);
+}
+
+void KinematicBuffer::remove(const uint32_t i) {
+  store_[0].remove(i);
+  store_[1].remove(i);
+}
+
+void KinematicBuffer::reserve(const uint32_t count) {
+  store_[0].reserve(count);
+  store_[1].reserve(count);
+}
+
+void KinematicBuffer::clear() {
+  store_[0].clear();
+  store_[1].clear();
+}
+
+void KinematicBuffer::set(const uint32_t i, const KinematicStatus& status) {
+  store_[0].set(i, status);
+  store_[1].set(i, status);
+}
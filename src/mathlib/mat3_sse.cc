@@ -42,12 +42,12 @@
 
   const Vec3 Mat3::getRow(unsigned short index) const {
     assert(index<3);
-    return Vec3(matrix_[0].m128_f32[index], matrix_[1].m128_f32[index], matrix_[2].m128_f32[index]);
+    return Vec3(sseLane(matrix_[0], index), sseLane(matrix_[1], index), sseLane(matrix_[2], index));
   }
 
   const __m128 Mat3::getRow_sse(unsigned short index) const {
     assert(index < 3);
-    return _mm_set_ps(0.0f, matrix_[0].m128_f32[index], matrix_[1].m128_f32[index], matrix_[2].m128_f32[index]);
+    return _mm_set_ps(0.0f, sseLane(matrix_[2], index), sseLane(matrix_[1], index), sseLane(matrix_[0], index));   //high to low
   }
 #pragma endregion
 
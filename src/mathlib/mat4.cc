@@ -5,9 +5,10 @@
 //                                                       |___/___/\____/  
 //----------------------------------------------------------------------------
 
-#include "mathlib\mat4.h"
+#include "mathlib/mat4.h"
 
 #include <cassert>
+#include <cstring>
 #define _USE_MATH_DEFINES
 #include <math.h>
 
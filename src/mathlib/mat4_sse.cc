@@ -43,12 +43,12 @@
 
   const Vec4 Mat4::getRow(unsigned short index) const {
     assert(index<4);
-    return Vec4(matrix_[0].m128_f32[index], matrix_[1].m128_f32[index], matrix_[2].m128_f32[index], matrix_[3].m128_f32[index]);
+    return Vec4(sseLane(matrix_[0], index), sseLane(matrix_[1], index), sseLane(matrix_[2], index), sseLane(matrix_[3], index));
   }
 
   const __m128 Mat4::getRow_sse(unsigned short index) const {
     assert(index<4);
-    return _mm_set_ps(matrix_[0].m128_f32[index], matrix_[1].m128_f32[index], matrix_[2].m128_f32[index], matrix_[3].m128_f32[index]);
+    return _mm_set_ps(sseLane(matrix_[3], index), sseLane(matrix_[2], index), sseLane(matrix_[1], index), sseLane(matrix_[0], index));   //high to low
   }
 #pragma endregion
 
@@ -138,9 +138,9 @@
 
 #pragma region Matrix Ops
   const Mat3 Mat4::to3x3() const {
-    float aux[9] = {matrix_[0].m128_f32[0], matrix_[0].m128_f32[1], matrix_[0].m128_f32[2],
-                    matrix_[1].m128_f32[0], matrix_[1].m128_f32[1], matrix_[1].m128_f32[2],
-                    matrix_[2].m128_f32[0], matrix_[2].m128_f32[1], matrix_[2].m128_f32[2] };
+    float aux[9] = {sseLane(matrix_[0], 0), sseLane(matrix_[0], 1), sseLane(matrix_[0], 2),
+                    sseLane(matrix_[1], 0), sseLane(matrix_[1], 1), sseLane(matrix_[1], 2),
+                    sseLane(matrix_[2], 0), sseLane(matrix_[2], 1), sseLane(matrix_[2], 2) };
     return Mat3(aux);
   }
 
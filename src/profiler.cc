@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <profiler.h>
+#include <defines.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+thread_local Profiler::ThreadRing* Profiler::thread_ring_ = nullptr;
+
+namespace {
+  const std::chrono::steady_clock::time_point g_origin = std::chrono::steady_clock::now();
+}
+
+uint64_t Profiler::now() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - g_origin).count();
+}
+
+Profiler::ThreadRing* Profiler::ring() {
+  if (!thread_ring_) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.emplace_back(new ThreadRing());
+    thread_ring_ = rings_.back().get();
+    thread_ring_->tid = (uint32_t)rings_.size();
+    thread_ring_->events.resize(PROFILER_EVENTS);
+  }
+  return thread_ring_;
+}
+
+void Profiler::record(const char* name, const uint64_t start, const uint64_t end) {
+  ThreadRing* r = ring();
+  const uint64_t count = r->count.load(std::memory_order_relaxed);
+  r->events[count % PROFILER_EVENTS] = Event{ name, start, end };
+  r->count.store(count + 1, std::memory_order_release);
+}
+
+bool Profiler::writeChromeTrace(const char* path) {
+  FILE* file = fopen(path, "w");
+  if (!file) {
+    printf("Failed to open trace file %s for writing\n", path);
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  fprintf(file, "{\"traceEvents\":[\n");
+  bool first = true;
+  uint32_t written = 0;
+  for (const auto& r : rings_) {
+    const uint64_t count = r->count.load(std::memory_order_acquire);
+    const uint64_t begin = (count > PROFILER_EVENTS) ? (count - PROFILER_EVENTS) : 0;
+    for (uint64_t i = begin; i < count; ++i) {
+      const Event& event = r->events[i % PROFILER_EVENTS];
+      fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        first ? "" : ",\n", event.name, r->tid, event.start / 1000.0, (event.end - event.start) / 1000.0);
+      first = false;
+      ++written;
+    }
+  }
+  fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+  fclose(file);
+  printf("Wrote %u profiler events to %s\n", written, path);
+  return true;
+}
+
+void Profiler::summary(const uint64_t since, const uint32_t frames, char* text, const size_t size) {
+  struct Total {
+    const char* name;
+    uint64_t ns;
+  };
+  Total totals[PROFILER_SUMMARY_LINES * 4];
+  uint32_t n_totals = 0;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& r : rings_) {
+      const uint64_t count = r->count.load(std::memory_order_acquire);
+      const uint64_t begin = (count > PROFILER_EVENTS) ? (count - PROFILER_EVENTS) : 0;
+      for (uint64_t i = count; i > begin; --i) {
+        const Event& event = r->events[(i - 1) % PROFILER_EVENTS];
+        if (event.end < since) break;       //rings are in end order, the rest is older
+        uint32_t t = 0;
+        while ((t < n_totals) && (totals[t].name != event.name)) ++t;
+        if (t == n_totals) {
+          if (n_totals == (sizeof(totals) / sizeof(totals[0]))) continue;
+          totals[n_totals++] = Total{ event.name, 0 };
+        }
+        totals[t].ns += event.end - event.start;
+      }
+    }
+  }
+
+  std::sort(totals, totals + n_totals, [](const Total& a, const Total& b) { return a.ns > b.ns; });
+  const double per_frame = 1.0 / (1e6 * ((frames > 0) ? frames : 1));
+  size_t used = 0;
+  if (size > 0) text[0] = '\0';
+  for (uint32_t t = 0; (t < n_totals) && (t < PROFILER_SUMMARY_LINES) && (used < size); ++t) {
+    const int n = snprintf(text + used, size - used, "%s %.2f ms\n", totals[t].name, totals[t].ns * per_frame);
+    if (n < 0) break;
+    used += (size_t)n;
+  }
+}
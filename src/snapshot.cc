@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <snapshot.h>
+#include <defines.h>
+
+#include <cmath>
+#include <utility>
+
+Snapshot::Transform Snapshot::blend(const Group& group, const uint32_t i, const float alpha) const {
+  const Transform& from = group.previous[i];
+  const Transform& to = group.agents[i];
+  const float dx = to.x - from.x;
+  const float dy = to.y - from.y;
+  if ((fabsf(dx) > (WINDOW_WIDTH / 2)) || (fabsf(dy) > (WINDOW_HEIGHT / 2))) {
+    return to;
+  }
+  return Transform{ from.x + (dx * alpha), from.y + (dy * alpha), lerpAngle(from.orientation, to.orientation, alpha) };
+}
+
+void SnapshotExchange::publish() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::swap(back_, ready_);
+  fresh_ = true;
+}
+
+const Snapshot* SnapshotExchange::acquire() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (fresh_) {
+    std::swap(front_, ready_);
+    fresh_ = false;
+  }
+  return front_;
+}
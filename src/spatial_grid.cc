@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <spatial_grid.h>
+
+#include <algorithm>
+#include <cmath>
+
+void SpatialGrid::init(const float width, const float height, const float cell_size) {
+  inv_cell_size_ = 1.0f / cell_size;
+  cols_ = std::max<int32_t>(1, (int32_t)ceil(width / cell_size));
+  rows_ = std::max<int32_t>(1, (int32_t)ceil(height / cell_size));
+
+  cell_start_.assign(cols_ * rows_ + 1, 0);
+  entries_.clear();
+  sorted_.clear();
+}
+
+void SpatialGrid::clear() {
+  entries_.clear();
+}
+
+void SpatialGrid::insert(const uint32_t index, const MathLib::Vec2& pos) {
+  Entry e;
+  e.cell = cellCoord(pos.y(), rows_) * cols_ + cellCoord(pos.x(), cols_);
+  e.index = index;
+  entries_.push_back(e);
+}
+
+void SpatialGrid::build() {
+  //counting sort by cell, cell_start_[c]..cell_start_[c + 1] ends up as the range of cell c
+  std::fill(cell_start_.begin(), cell_start_.end(), 0);
+  for (const auto& e : entries_) {
+    ++cell_start_[e.cell + 1];
+  }
+  for (size_t c = 1; c < cell_start_.size(); ++c) {
+    cell_start_[c] += cell_start_[c - 1];
+  }
+
+  sorted_.resize(entries_.size());
+  cursor_.assign(cell_start_.begin(), cell_start_.end() - 1);
+  for (const auto& e : entries_) {
+    sorted_[cursor_[e.cell]++] = e.index;
+  }
+}
@@ -6,11 +6,22 @@
 //----------------------------------------------------------------------------
 
 #include <sprite.h>
+#include <sprite_batch.h>
 
 void Sprite::render() const {
   if (visible_) renderText(position_.x, position_.y, nullptr, angle_);
 }
 
+void Sprite::render(SpriteBatch* batch) const {
+  if (visible_ && getTexture()) batch->add(getTexture(), position_.x, position_.y, getWidth(), getHeight(), angle_);
+}
+
+void Sprite::render(SpriteBatch* batch, const float x, const float y, const float angle) const {
+  if (visible_ && getTexture()) {
+    batch->add(getTexture(), (int)x - (getWidth() / 2), (int)y - (getHeight() / 2), getWidth(), getHeight(), angle);
+  }
+}
+
 void Sprite::setVisible(const bool visible) {
   visible_ = visible;
 }
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <sprite_batch.h>
+#include <window.h>
+#include <defines.h>
+
+#include <cmath>
+
+void SpriteBatch::add(SDL_Texture* texture, const int x, const int y, const int w, const int h, const float angle) {
+  for (auto& bucket : buckets_) {
+    if (bucket.texture == texture) {
+      bucket.quads.push_back(Quad{ x, y, w, h, angle });
+      return;
+    }
+  }
+  buckets_.push_back(Bucket{ texture, std::vector<Quad>() });
+  buckets_.back().quads.push_back(Quad{ x, y, w, h, angle });
+}
+
+void SpriteBatch::flush() {
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+
+  for (auto& bucket : buckets_) {
+    if (!renderer || bucket.quads.empty()) {
+      bucket.quads.clear();
+      continue;
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    //same placement as SDL_RenderCopyEx, corners rotated clockwise around the center
+    vertices_.clear();
+    indices_.clear();
+    const SDL_Color white = { 0xFF, 0xFF, 0xFF, 0xFF };
+    const float u[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    const float v[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    for (const auto& quad : bucket.quads) {
+      const float hw = quad.w * 0.5f;
+      const float hh = quad.h * 0.5f;
+      const float cx = quad.x + hw;
+      const float cy = quad.y + hh;
+      const float c = cosf(quad.angle);
+      const float s = sinf(quad.angle);
+      const int base = (int)vertices_.size();
+      for (int k = 0; k < 4; ++k) {
+        const float lx = (u[k] * 2.0f - 1.0f) * hw;
+        const float ly = (v[k] * 2.0f - 1.0f) * hh;
+        SDL_Vertex vertex;
+        vertex.position.x = cx + (lx * c) - (ly * s);
+        vertex.position.y = cy + (lx * s) + (ly * c);
+        vertex.color = white;
+        vertex.tex_coord.x = u[k];
+        vertex.tex_coord.y = v[k];
+        vertices_.push_back(vertex);
+      }
+      const int quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+      for (const int index : quad_indices) {
+        indices_.push_back(base + index);
+      }
+    }
+    SDL_RenderGeometry(renderer, bucket.texture, vertices_.data(), (int)vertices_.size(),
+      indices_.data(), (int)indices_.size());
+#else
+    for (const auto& quad : bucket.quads) {
+      const SDL_Rect dst = { quad.x, quad.y, quad.w, quad.h };
+      SDL_RenderCopyEx(renderer, bucket.texture, nullptr, &dst, (quad.angle * 180) / M_PI, nullptr, SDL_FLIP_NONE);
+    }
+#endif
+    bucket.quads.clear();
+  }
+}
@@ -0,0 +1,233 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <steering_kernels.h>
+#include <mathlib/fast_math.h>
+
+#include <cmath>
+
+#if defined(__AVX__)
+#define SK_USE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SK_USE_SSE 1
+#endif
+
+#if defined(SK_USE_AVX) || defined(SK_USE_SSE)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
+
+namespace {
+
+  //each lane type exposes the same small set of operations so every kernel
+  //is written once and instanced for the vector width and the scalar tail
+  struct LaneScalar {
+    typedef float V;
+    typedef bool M;
+    static const uint32_t width = 1;
+    static V load(const float* p) { return *p; }
+    static void store(float* p, const V v) { *p = v; }
+    static V set1(const float v) { return v; }
+    static V add(const V a, const V b) { return a + b; }
+    static V sub(const V a, const V b) { return a - b; }
+    static V mul(const V a, const V b) { return a * b; }
+    static V div(const V a, const V b) { return a / b; }
+    static V sqrt(const V a) { return std::sqrt(a); }
+    static V rsqrt(const V a) { return MathLib::Fast::rsqrt(a); }
+    static M lt(const V a, const V b) { return a < b; }
+    static V select(const M m, const V a, const V b) { return m ? a : b; }
+  };
+
+#if defined(SK_USE_SSE)
+  struct LaneSIMD {
+    typedef __m128 V;
+    typedef __m128 M;
+    static const uint32_t width = 4;
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, const V v) { _mm_storeu_ps(p, v); }
+    static V set1(const float v) { return _mm_set1_ps(v); }
+    static V add(const V a, const V b) { return _mm_add_ps(a, b); }
+    static V sub(const V a, const V b) { return _mm_sub_ps(a, b); }
+    static V mul(const V a, const V b) { return _mm_mul_ps(a, b); }
+    static V div(const V a, const V b) { return _mm_div_ps(a, b); }
+    static V sqrt(const V a) { return _mm_sqrt_ps(a); }
+    //lane for lane the same value as MathLib::Fast::rsqrt
+    static V rsqrt(const V a) {
+      const V half_a = _mm_mul_ps(_mm_set1_ps(0.5f), a);
+      const V three_halves = _mm_set1_ps(1.5f);
+#if ML_USE_SSE
+      const V y = _mm_rsqrt_ps(a);
+      return _mm_mul_ps(y, _mm_sub_ps(three_halves, _mm_mul_ps(_mm_mul_ps(half_a, y), y)));
+#else
+      V y = _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32(0x5f375a86), _mm_srli_epi32(_mm_castps_si128(a), 1)));
+      y = _mm_mul_ps(y, _mm_sub_ps(three_halves, _mm_mul_ps(_mm_mul_ps(half_a, y), y)));
+      return _mm_mul_ps(y, _mm_sub_ps(three_halves, _mm_mul_ps(_mm_mul_ps(half_a, y), y)));
+#endif
+    }
+    static M lt(const V a, const V b) { return _mm_cmplt_ps(a, b); }
+    static V select(const M m, const V a, const V b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+  };
+#elif defined(SK_USE_AVX)
+  struct LaneSIMD {
+    typedef __m256 V;
+    typedef __m256 M;
+    static const uint32_t width = 8;
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, const V v) { _mm256_storeu_ps(p, v); }
+    static V set1(const float v) { return _mm256_set1_ps(v); }
+    static V add(const V a, const V b) { return _mm256_add_ps(a, b); }
+    static V sub(const V a, const V b) { return _mm256_sub_ps(a, b); }
+    static V mul(const V a, const V b) { return _mm256_mul_ps(a, b); }
+    static V div(const V a, const V b) { return _mm256_div_ps(a, b); }
+    static V sqrt(const V a) { return _mm256_sqrt_ps(a); }
+    //lane for lane the same value as MathLib::Fast::rsqrt, AVX has no 256 bit
+    //integer ops so the scalar initial guess goes through the two halves
+    static V rsqrt(const V a) {
+      const V half_a = _mm256_mul_ps(_mm256_set1_ps(0.5f), a);
+      const V three_halves = _mm256_set1_ps(1.5f);
+#if ML_USE_SSE
+      const V y = _mm256_rsqrt_ps(a);
+      return _mm256_mul_ps(y, _mm256_sub_ps(three_halves, _mm256_mul_ps(_mm256_mul_ps(half_a, y), y)));
+#else
+      const __m128i magic = _mm_set1_epi32(0x5f375a86);
+      const __m128i lo = _mm_sub_epi32(magic, _mm_srli_epi32(_mm_castps_si128(_mm256_castps256_ps128(a)), 1));
+      const __m128i hi = _mm_sub_epi32(magic, _mm_srli_epi32(_mm_castps_si128(_mm256_extractf128_ps(a, 1)), 1));
+      V y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(lo)), _mm_castsi128_ps(hi), 1);
+      y = _mm256_mul_ps(y, _mm256_sub_ps(three_halves, _mm256_mul_ps(_mm256_mul_ps(half_a, y), y)));
+      return _mm256_mul_ps(y, _mm256_sub_ps(three_halves, _mm256_mul_ps(_mm256_mul_ps(half_a, y), y)));
+#endif
+    }
+    static M lt(const V a, const V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static V select(const M m, const V a, const V b) { return _mm256_blendv_ps(b, a, m); }
+  };
+#else
+  typedef LaneScalar LaneSIMD;
+#endif
+
+  //(dir / |dir|) * scale, zero when |dir| is zero. under ML_FAST_MATH it is
+  //dir * rsqrt(|dir|^2) * scale, the arithmetic of Vec2::normalized, so a mode
+  //gives the same result batched or not
+  template <typename L>
+  inline void scaledNormal(const typename L::V dx, const typename L::V dy, const typename L::V scale,
+    typename L::V* out_x, typename L::V* out_y) {
+    const typename L::V zero = L::set1(0.0f);
+#if ML_FAST_MATH
+    const typename L::V len2 = L::add(L::mul(dx, dx), L::mul(dy, dy));
+    const typename L::M valid = L::lt(zero, len2);
+    const typename L::V inv = L::rsqrt(L::select(valid, len2, L::set1(1.0f)));
+    *out_x = L::select(valid, L::mul(L::mul(dx, inv), scale), zero);
+    *out_y = L::select(valid, L::mul(L::mul(dy, inv), scale), zero);
+#else
+    const typename L::V len = L::sqrt(L::add(L::mul(dx, dx), L::mul(dy, dy)));
+    const typename L::M valid = L::lt(zero, len);
+    const typename L::V safe_len = L::select(valid, len, L::set1(1.0f));
+    *out_x = L::select(valid, L::mul(L::div(dx, safe_len), scale), zero);
+    *out_y = L::select(valid, L::mul(L::div(dy, safe_len), scale), zero);
+#endif
+  }
+
+  template <typename L>
+  void seekRange(uint32_t i, const uint32_t end, const float* pos_x, const float* pos_y,
+    const float target_x, const float target_y, const float sign, const float max_acc,
+    float* linear_x, float* linear_y) {
+    const typename L::V tx = L::set1(target_x);
+    const typename L::V ty = L::set1(target_y);
+    const typename L::V s = L::set1(sign);
+    const typename L::V acc = L::set1(max_acc);
+    for (; i + L::width <= end; i += L::width) {
+      const typename L::V dx = L::mul(L::sub(tx, L::load(pos_x + i)), s);
+      const typename L::V dy = L::mul(L::sub(ty, L::load(pos_y + i)), s);
+      typename L::V lx, ly;
+      scaledNormal<L>(dx, dy, acc, &lx, &ly);
+      L::store(linear_x + i, lx);
+      L::store(linear_y + i, ly);
+    }
+  }
+
+  template <typename L>
+  void arriveRange(uint32_t i, const uint32_t end, const float* pos_x, const float* pos_y,
+    const float* vel_x, const float* vel_y, const float target_x, const float target_y,
+    const float max_speed, const float max_acc, const float slow_radius, const float time_to_target,
+    float* linear_x, float* linear_y) {
+    const typename L::V tx = L::set1(target_x);
+    const typename L::V ty = L::set1(target_y);
+    const typename L::V speed = L::set1(max_speed);
+    const typename L::V acc = L::set1(max_acc);
+    const typename L::V slow = L::set1(slow_radius);
+    const typename L::V ttt = L::set1(time_to_target);
+    for (; i + L::width <= end; i += L::width) {
+      const typename L::V dx = L::sub(tx, L::load(pos_x + i));
+      const typename L::V dy = L::sub(ty, L::load(pos_y + i));
+      const typename L::V dist = L::sqrt(L::add(L::mul(dx, dx), L::mul(dy, dy)));
+
+      //slow down inside the slow radius
+      const typename L::V target_speed = L::select(L::lt(dist, slow), L::mul(speed, L::div(dist, slow)), speed);
+      typename L::V tvx, tvy;
+      scaledNormal<L>(dx, dy, target_speed, &tvx, &tvy);
+
+      typename L::V lx = L::div(L::sub(tvx, L::load(vel_x + i)), ttt);
+      typename L::V ly = L::div(L::sub(tvy, L::load(vel_y + i)), ttt);
+
+      //clamp to the max acceleration
+      const typename L::V len2 = L::add(L::mul(lx, lx), L::mul(ly, ly));
+      const typename L::M over = L::lt(acc, L::sqrt(len2));
+#if ML_FAST_MATH
+      const typename L::V inv = L::rsqrt(L::select(over, len2, L::set1(1.0f)));
+      lx = L::select(over, L::mul(L::mul(lx, inv), acc), lx);
+      ly = L::select(over, L::mul(L::mul(ly, inv), acc), ly);
+#else
+      const typename L::V safe_len = L::select(over, L::sqrt(len2), L::set1(1.0f));
+      lx = L::select(over, L::mul(L::div(lx, safe_len), acc), lx);
+      ly = L::select(over, L::mul(L::div(ly, safe_len), acc), ly);
+#endif
+
+      L::store(linear_x + i, lx);
+      L::store(linear_y + i, ly);
+    }
+  }
+}
+
+const char* SteeringKernels::isa() {
+#if defined(SK_USE_AVX)
+  return "AVX";
+#elif defined(SK_USE_SSE)
+  return "SSE2";
+#else
+  return "scalar";
+#endif
+}
+
+void SteeringKernels::seek(const uint32_t count, const float* pos_x, const float* pos_y,
+  const float target_x, const float target_y, const float max_acc,
+  float* linear_x, float* linear_y) {
+  const uint32_t body = count - (count % LaneSIMD::width);
+  seekRange<LaneSIMD>(0, body, pos_x, pos_y, target_x, target_y, 1.0f, max_acc, linear_x, linear_y);
+  seekRange<LaneScalar>(body, count, pos_x, pos_y, target_x, target_y, 1.0f, max_acc, linear_x, linear_y);
+}
+
+void SteeringKernels::flee(const uint32_t count, const float* pos_x, const float* pos_y,
+  const float target_x, const float target_y, const float max_acc,
+  float* linear_x, float* linear_y) {
+  const uint32_t body = count - (count % LaneSIMD::width);
+  seekRange<LaneSIMD>(0, body, pos_x, pos_y, target_x, target_y, -1.0f, max_acc, linear_x, linear_y);
+  seekRange<LaneScalar>(body, count, pos_x, pos_y, target_x, target_y, -1.0f, max_acc, linear_x, linear_y);
+}
+
+void SteeringKernels::arrive(const uint32_t count, const float* pos_x, const float* pos_y,
+  const float* vel_x, const float* vel_y,
+  const float target_x, const float target_y, const float max_speed, const float max_acc,
+  const float slow_radius, const float time_to_target,
+  float* linear_x, float* linear_y) {
+  const uint32_t body = count - (count % LaneSIMD::width);
+  arriveRange<LaneSIMD>(0, body, pos_x, pos_y, vel_x, vel_y, target_x, target_y,
+    max_speed, max_acc, slow_radius, time_to_target, linear_x, linear_y);
+  arriveRange<LaneScalar>(body, count, pos_x, pos_y, vel_x, vel_y, target_x, target_y,
+    max_speed, max_acc, slow_radius, time_to_target, linear_x, linear_y);
+}
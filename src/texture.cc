@@ -6,10 +6,10 @@
 //----------------------------------------------------------------------------
 
 #include <texture.h>
+#include <texture_cache.h>
 #include <window.h>
 #include <defines.h>
 
-#include <SDL/SDL_image.h>
 #include <cstdio>
 
 
@@ -32,37 +32,16 @@ Texture::~Texture() {
 }
 
 bool Texture::loadFromFile(const char* path) {
-  SDL_Renderer* renderer = Window::instance().getRenderer();
   free();
-
-  SDL_Texture* newTexture = nullptr;
-
-  SDL_Surface* loadedSurface = IMG_Load(path);
-  if (loadedSurface == NULL) {
-    printf("Unable to load image %s! SDL_image Error: %s\n", path, IMG_GetError());
-  }
-  else {
-    SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, 0, 0xFF, 0xFF));
-
-    newTexture = SDL_CreateTextureFromSurface(renderer, loadedSurface);
-    if (newTexture == NULL) {
-      printf("Unable to create texture from %s! SDL Error: %s\n", path, SDL_GetError());
-    }
-    else {
-      width_ = loadedSurface->w;
-      height_ = loadedSurface->h;
-    }
-
-    SDL_FreeSurface(loadedSurface);
-  }
-
-  texture_ = newTexture;
+  texture_ = TextureCache::instance().acquire(path, &width_, &height_);
+  shared_ = (texture_ != nullptr);
   return texture_ != nullptr;
 }
 
 bool Texture::loadFromRenderedText(const char* textureText, const SDL_Color& textColor, TTF_Font* font, const bool shadow, const bool wrapped) {
   SDL_Renderer* renderer = Window::instance().getRenderer();
   free();
+  if (!renderer) return false;
 
   int shadowOffset = 1;
   if (TTF_FontHeight(font) > 40) {
@@ -124,8 +103,13 @@ bool Texture::loadFromRenderedText(const char* textureText, const SDL_Color& tex
 
 void Texture::free() {
   if (texture_) {
-    SDL_DestroyTexture(texture_);
+    if (shared_) {
+      TextureCache::instance().release(texture_);
+    } else {
+      SDL_DestroyTexture(texture_);
+    }
     texture_ = nullptr;
+    shared_ = false;
     width_ = 0;
     height_ = 0;
   }
@@ -144,6 +128,7 @@ void Texture::setAlpha(const uint8_t alpha) const {
 }
 
 void Texture::renderText(const uint32_t x, const uint32_t y, const SDL_Rect* clip, const float angle, const SDL_Point* center, const SDL_RendererFlip flip) const {
+  if (!texture_) return;
   const float angle_rad = (angle * 180) / M_PI;
   SDL_Renderer* renderer = Window::instance().getRenderer();
   SDL_Rect renderQuad = { x, y, width_, height_ };
@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <texture_cache.h>
+#include <window.h>
+
+#include <SDL/SDL_image.h>
+#include <cstdio>
+
+SDL_Texture* TextureCache::acquire(const char* path, int* width, int* height) {
+  auto found = entries_.find(path);
+  if (found != entries_.end()) {
+    ++found->second.refs;
+    *width = found->second.width;
+    *height = found->second.height;
+    return found->second.texture;
+  }
+
+  SDL_Renderer* renderer = Window::instance().getRenderer();
+  if (!renderer) return nullptr;
+
+  SDL_Surface* loadedSurface = IMG_Load(path);
+  if (loadedSurface == NULL) {
+    printf("Unable to load image %s! SDL_image Error: %s\n", path, IMG_GetError());
+    return nullptr;
+  }
+
+  SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, 0, 0xFF, 0xFF));
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, loadedSurface);
+  if (texture == NULL) {
+    printf("Unable to create texture from %s! SDL Error: %s\n", path, SDL_GetError());
+  } else {
+    entries_[path] = Entry{ texture, loadedSurface->w, loadedSurface->h, 1 };
+    *width = loadedSurface->w;
+    *height = loadedSurface->h;
+  }
+  SDL_FreeSurface(loadedSurface);
+
+  return texture;
+}
+
+void TextureCache::release(SDL_Texture* texture) {
+  //a handful of files, a linear search is enough
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->second.texture == texture) {
+      if (--it->second.refs == 0) {
+        SDL_DestroyTexture(texture);
+        entries_.erase(it);
+      }
+      return;
+    }
+  }
+}
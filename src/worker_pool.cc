@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <worker_pool.h>
+
+void WorkerPool::init(const uint32_t n_threads) {
+  shutdown();
+
+  uint32_t n = n_threads;
+  if (n == 0) {
+    n = std::thread::hardware_concurrency();
+  }
+
+  quit_ = false;
+  for (uint32_t i = 1; i < n; ++i) {
+    threads_.emplace_back(&WorkerPool::workerLoop, this, generation_);
+  }
+}
+
+void WorkerPool::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+void WorkerPool::parallelFor(const uint32_t count, const uint32_t grain,
+  const std::function<void(const uint32_t, const uint32_t)>& fn) {
+  if (threads_.empty() || count <= grain) {
+    if (count > 0) fn(0, count);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &fn;
+    count_ = count;
+    grain_ = grain;
+    next_ = 0;
+    active_ = (uint32_t)threads_.size();
+    ++generation_;
+  }
+  wake_.notify_all();
+
+  runChunks();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this]() { return active_ == 0; });
+  job_ = nullptr;
+}
+
+void WorkerPool::workerLoop(uint32_t seen) {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this, seen]() { return quit_ || (generation_ != seen); });
+      if (quit_) return;
+      seen = generation_;
+    }
+
+    runChunks();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --active_;
+    }
+    done_.notify_one();
+  }
+}
+
+void WorkerPool::runChunks() {
+  while (true) {
+    const uint32_t begin = next_.fetch_add(grain_);
+    if (begin >= count_) return;
+    const uint32_t end = (begin + grain_ < count_) ? begin + grain_ : count_;
+    (*job_)(begin, end);
+  }
+}
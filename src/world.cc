@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+#include <world.h>
+#include <profiler.h>
+
+namespace {
+  void copyTransforms(const KinematicStore& kinematics, std::vector<Snapshot::Transform>* out) {
+    out->resize(kinematics.size());
+    for (uint32_t i = 0; i < kinematics.size(); ++i) {
+      (*out)[i] = Snapshot::Transform{ kinematics.posX()[i], kinematics.posY()[i], kinematics.orientation()[i] };
+    }
+  }
+}
+
+void World::step(const std::vector<Command>& commands) {
+  PROFILE_SCOPE("World::step");
+  for (const auto& command : commands) {
+    apply(command);
+  }
+
+  target_.update(TICK_MS);
+  kinematic_.swap();
+  ia_.update(TICK_MS);
+  ++tick_;
+}
+
+void World::apply(const Command& command) {
+  KinematicStatus target = target_.getKinematic();
+  switch (command.type) {
+    case Command::Type::TargetPosition:
+      target.position = Vec2(command.x, command.y);
+      break;
+    case Command::Type::TargetSpeed:
+      target.speed = clamp(target.speed + command.x, 0.0f, 140.0f);
+      break;
+    case Command::Type::TargetOrientation:
+      target.orientation += command.x;
+      break;
+    case Command::Type::Steering:
+      ia_.setSteering((Body::SteeringMode)command.mode);
+      return;
+  }
+  target_.setKinematic(target);
+}
+
+void World::snapshot(Snapshot* out) const {
+  PROFILE_SCOPE("World::snapshot");
+  out->tick = tick_;
+  out->groups.resize(2);
+
+  out->groups[0].color = Body::Color::Red;
+  copyTransforms(kinematic_.previous(), &out->groups[0].previous);
+  copyTransforms(kinematic_.front(), &out->groups[0].agents);
+
+  out->groups[1].color = ia_.color();
+  copyTransforms(ia_.previousKinematics(), &out->groups[1].previous);
+  copyTransforms(ia_.kinematics(), &out->groups[1].agents);
+
+  target_.recordDebug();
+  ia_.recordDebug();
+  DebugDraw::capture(&out->debug);
+}
+
+uint64_t World::checksum() const {
+  uint64_t h = 14695981039346656037ULL;
+  h = kinematic_.front().hash(h);
+  return ia_.kinematics().hash(h);
+}
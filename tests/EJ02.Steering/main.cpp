@@ -6,24 +6,93 @@
 //----------------------------------------------------------------------------
 
 #include <game.h>
+#include <debug_draw.h>
 #include <defines.h>
+#include <input_log.h>
+#include <profiler.h>
 #include <window.h>
+#include <world.h>
+#include <worker_pool.h>
+
+#include <chrono>
 #include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+//usage: EJ02.Steering [n_agents] [--headless ticks] [--seed n] [--record file] [--replay file]
+//                     [--trail length] [--trace file]
+//a replay takes its seed and agent count from the log
+int main(int argc, char* argv[]) {
+  uint32_t n_agents = DEFAULT_N_AGENTS;
+  uint32_t headless_ticks = 0;
+  uint64_t seed = (uint64_t)time(NULL);
+  const char* record_path = nullptr;
+  const char* replay_path = nullptr;
+  const char* trace_path = nullptr;         //chrome trace of the last profiled scopes, written on exit
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--headless") && (i + 1 < argc)) {
+      headless_ticks = (uint32_t)atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--seed") && (i + 1 < argc)) {
+      seed = strtoull(argv[++i], nullptr, 10);
+    } else if (!strcmp(argv[i], "--record") && (i + 1 < argc)) {
+      record_path = argv[++i];
+    } else if (!strcmp(argv[i], "--replay") && (i + 1 < argc)) {
+      replay_path = argv[++i];
+    } else if (!strcmp(argv[i], "--trace") && (i + 1 < argc)) {
+      trace_path = argv[++i];
+    } else if (!strcmp(argv[i], "--trail") && (i + 1 < argc)) {
+      DebugDraw::setTrailLength((uint16_t)atoi(argv[++i]));
+    } else {
+      n_agents = (uint32_t)atoi(argv[i]);
+    }
+  }
+
+  InputLog log;
+  if (replay_path) {
+    if (!log.replay(replay_path)) return 1;
+    seed = log.seed();
+    n_agents = log.agents();
+  } else if (record_path) {
+    if (!log.record(record_path, seed, n_agents)) return 1;
+  }
+  printf("Seed %llu\n", (unsigned long long)seed);
+
+  WorkerPool::instance().init();
 
-int main(int,char*[]) {
-  srand(time(NULL));
+  if (headless_ticks > 0) {     //no window, renderer, textures or debug draw
+    World world;
+    world.init(n_agents, seed);
+
+    std::vector<Command> commands;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < headless_ticks; ++t) {
+      log.process(world.tick(), &commands);
+      world.step(commands);
+      commands.clear();
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("%u agents, %u ticks in %.3f s, checksum %016llx\n", n_agents, headless_ticks, secs,
+      (unsigned long long)world.checksum());
+    if (trace_path) Profiler::instance().writeChromeTrace(trace_path);
+    WorkerPool::instance().shutdown();
+    return 0;
+  }
 
   Window::instance().init(GAME_NAME, WINDOW_WIDTH, WINDOW_HEIGHT);
 
   {
     Game game;
 
-    game.init();
+    game.init(n_agents, seed, &log);
     game.start();
     game.shutdown();
   }
+  if (trace_path) Profiler::instance().writeChromeTrace(trace_path);
 
   Window::instance().shutdown();
+  WorkerPool::instance().shutdown();
 
   return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+//MathLib microbenchmark, the implementation is chosen at build time so build
+//it with and without --sse and compare the reports, checksums must match.
+//the fast math section always times MathLib::Fast against the precise libm
+//call and checks the worst error against the bounds in fast_math.h, whatever
+//ML_FAST_MATH is set to. the exit code is nonzero when a bound is broken
+
+#include <mathlib/vec2.h>
+#include <mathlib/vec3.h>
+#include <mathlib/vec4.h>
+#include <mathlib/mat4.h>
+#include <mathlib/fast_math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace MathLib;
+
+#define N_ELEMENTS 4096
+#define N_REPEATS 2000
+
+template <typename Fn>
+void bench(const char* name, Fn fn) {
+  fn();       //warm up
+  const auto start = std::chrono::steady_clock::now();
+  float checksum = 0.0f;
+  for (uint32_t r = 0; r < N_REPEATS; ++r) {
+    checksum += fn();
+  }
+  const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  printf("%-20s %8.3f ns/op   checksum %.6e\n", name, ns / ((double)N_REPEATS * N_ELEMENTS), checksum);
+}
+
+//worst absolute (or relative) difference between fast and precise over n
+//inputs, false when it goes over bound
+template <typename Fn>
+bool accuracy(const char* name, const uint32_t n, const bool relative, const double bound, Fn fn) {
+  double worst = 0.0;
+  for (uint32_t i = 0; i < n; ++i) {
+    double fast, precise;
+    fn(i, &fast, &precise);
+    double err = std::fabs(fast - precise);
+    if (relative) err /= std::fabs(precise);
+    worst = std::max(worst, err);
+  }
+  const bool pass = (worst <= bound);
+  printf("%-20s max %s error %.3e   bound %.1e   %s\n", name, relative ? "rel" : "abs", worst, bound,
+    pass ? "ok" : "FAIL");
+  return pass;
+}
+
+inline float randf() {
+  return ((float)rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+}
+
+int main(int, char*[]) {
+  srand(1234);
+  printf("MathLib %s path\n", ML_USE_SSE ? "SSE" : "scalar");
+
+  std::vector<Vec2> a2(N_ELEMENTS), b2(N_ELEMENTS);
+  std::vector<Vec3> a3(N_ELEMENTS), b3(N_ELEMENTS);
+  std::vector<Vec4> a4(N_ELEMENTS);
+  for (uint32_t i = 0; i < N_ELEMENTS; ++i) {
+    a2[i] = Vec2(randf(), randf());
+    b2[i] = Vec2(randf(), randf());
+    a3[i] = Vec3(randf(), randf(), randf());
+    b3[i] = Vec3(randf(), randf(), randf());
+    a4[i] = Vec4(randf(), randf(), randf(), randf());
+  }
+  float m[16];
+  for (uint32_t i = 0; i < 16; ++i) m[i] = randf();
+  const Mat4 mat(m);
+
+  bench("Vec2 add/scale", [&]() {
+    Vec2 acc;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += (a2[i] + b2[i]) * 0.5f;
+    return acc.x() + acc.y();
+  });
+  bench("Vec2 dot", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a2[i].dot(b2[i]);
+    return acc;
+  });
+  bench("Vec2 length", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a2[i].length();
+    return acc;
+  });
+  bench("Vec2 normalized", [&]() {
+    Vec2 acc;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a2[i].normalized();
+    return acc.x() + acc.y();
+  });
+  bench("Vec3 cross", [&]() {
+    Vec3 acc;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a3[i] ^ b3[i];
+    return acc.x() + acc.y() + acc.z();
+  });
+  bench("Vec3 normalized", [&]() {
+    Vec3 acc;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a3[i].normalized();
+    return acc.x() + acc.y() + acc.z();
+  });
+  bench("Vec4 dot", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a4[i].dot(a4[N_ELEMENTS - 1 - i]);
+    return acc;
+  });
+  bench("Mat4 * Vec4", [&]() {
+    Vec4 acc;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += mat * a4[i];
+    return acc.x() + acc.y() + acc.z() + acc.w();
+  });
+
+  printf("\nfast math, %s by default (ML_FAST_MATH)\n", ML_FAST_MATH ? "on" : "off");
+  std::vector<float> angles(N_ELEMENTS);
+  for (uint32_t i = 0; i < N_ELEMENTS; ++i) angles[i] = randf() * 64.0f;
+
+  bench("sqrt divide", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a2[i].x() / std::sqrt(a2[i].length2());
+    return acc;
+  });
+  bench("Fast::rsqrt", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += a2[i].x() * Fast::rsqrt(a2[i].length2());
+    return acc;
+  });
+  bench("atan2", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += std::atan2(a2[i].y(), a2[i].x());
+    return acc;
+  });
+  bench("Fast::atan2", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += Fast::atan2(a2[i].y(), a2[i].x());
+    return acc;
+  });
+  bench("sin + cos", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += std::sin(angles[i]) + std::cos(angles[i]);
+    return acc;
+  });
+  bench("Fast::sincos", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) {
+      float s, c;
+      Fast::sincos(angles[i], &s, &c);
+      acc += s + c;
+    }
+    return acc;
+  });
+  bench("fmod wrap", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) {
+      double w = fmod(angles[i] + ML_PI, ML_PI * 2.0);
+      if (w < 0) w += ML_PI * 2.0;
+      acc += (float)(w - ML_PI);
+    }
+    return acc;
+  });
+  bench("Fast::wrapAngle", [&]() {
+    float acc = 0.0f;
+    for (uint32_t i = 0; i < N_ELEMENTS; ++i) acc += Fast::wrapAngle(angles[i]);
+    return acc;
+  });
+
+  //sweeps over the ranges the bounds in fast_math.h are quoted for
+  const uint32_t steps = 1 << 20;
+  bool pass = true;
+  pass &= accuracy("Fast::rsqrt", steps, true, Fast::kRsqrtMaxRelError, [](const uint32_t i, double* fast, double* precise) {
+    const float x = std::ldexp(1.0f + (float)i / steps, (int)(i % 40) - 20);
+    *fast = Fast::rsqrt(x);
+    *precise = 1.0 / std::sqrt((double)x);
+  });
+  pass &= accuracy("Fast::atan2", steps, false, Fast::kAngleMaxAbsError, [](const uint32_t i, double* fast, double* precise) {
+    const double a = (ML_PI * 2.0 * i) / steps;
+    const float y = (float)std::sin(a) * (1.0f + (i % 7));
+    const float x = (float)std::cos(a) * (1.0f + (i % 7));
+    *fast = Fast::atan2(y, x);
+    *precise = std::atan2((double)y, (double)x);
+  });
+  pass &= accuracy("Fast::sincos sin", steps, false, Fast::kAngleMaxAbsError, [](const uint32_t i, double* fast, double* precise) {
+    const float a = (128.0f * i) / steps - 64.0f;
+    float s, c;
+    Fast::sincos(a, &s, &c);
+    *fast = s;
+    *precise = std::sin((double)a);
+  });
+  pass &= accuracy("Fast::sincos cos", steps, false, Fast::kAngleMaxAbsError, [](const uint32_t i, double* fast, double* precise) {
+    const float a = (128.0f * i) / steps - 64.0f;
+    float s, c;
+    Fast::sincos(a, &s, &c);
+    *fast = c;
+    *precise = std::cos((double)a);
+  });
+  pass &= accuracy("Fast::wrapAngle", steps, false, Fast::kAngleMaxAbsError, [](const uint32_t i, double* fast, double* precise) {
+    const float a = (128.0f * i) / steps - 64.0f;
+    *fast = Fast::wrapAngle(a);
+    double w = std::remainder((double)a, ML_PI * 2.0);
+    *precise = w;
+  });
+
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+//----------------------------------------------------------------------------
+//                                                        _   ________  __
+//  Copyright VIU 2018                                   | | / /  _/ / / /
+//  Author: Ivan Fuertes <ivan.fuertes@campusviu.es>     | |/ // // /_/ /
+//                                                       |___/___/\____/
+//----------------------------------------------------------------------------
+
+//steering benchmark, runs every Body::SteeringMode headless for each agent
+//count and prints one CSV row per run:
+//  mode,agents,ticks,threads,seconds,ticks_per_sec,ns_per_agent_tick,allocs,alloc_bytes,checksum
+//allocs and alloc_bytes count operator new calls during the timed ticks only.
+//the target circles off-centre, driven by commands the way a player would,
+//and the agents start with a random heading and speed so every mode moves
+//
+//usage: Steering.Bench [--agents 100,1000] [--ticks n] [--warmup n] [--seed n]
+//                      [--threads n] [--mode name]
+
+#include <command.h>
+#include <defines.h>
+#include <random.h>
+#include <world.h>
+#include <worker_pool.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace {
+  std::atomic<uint64_t> g_allocs{ 0 };
+  std::atomic<uint64_t> g_alloc_bytes{ 0 };
+
+  void* countedAlloc(const size_t size) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+  }
+
+  const float kTargetSpeed = 100.0f;       //px/s
+  const float kTargetTurn = 0.02f;         //rad per tick, a circle of ~170px around the centre
+
+  //commands for tick, the first one places the target and sets it going
+  void driveTarget(const uint32_t tick, std::vector<Command>* commands) {
+    commands->clear();
+    Command command;
+    command.tick = tick;
+    if (tick == 0) {
+      command.type = Command::Type::TargetPosition;
+      command.x = WINDOW_WIDTH / 2;
+      command.y = (WINDOW_HEIGHT / 2) - 170.0f;
+      commands->push_back(command);
+      command.type = Command::Type::TargetSpeed;
+      command.x = kTargetSpeed;
+      commands->push_back(command);
+    }
+    command.type = Command::Type::TargetOrientation;
+    command.x = kTargetTurn;
+    commands->push_back(command);
+  }
+
+  //random heading and speed, so the orientation and velocity modes have work to do
+  void scatterHeadings(World* world, const uint64_t seed) {
+    Random rng(seed, 0x5eed);
+    AgentGroup* group = world->ia();
+    for (uint32_t i = 0; i < group->size(); ++i) {
+      Agent* agent = group->getAgent(i);
+      KinematicStatus status = agent->getKinematic();
+      status.orientation = rng.range(-3.14159f, 3.14159f);
+      status.speed = rng.range(0.0f, 50.0f);
+      status.velocity.fromPolar(status.speed, status.orientation);
+      agent->setKinematic(status);
+    }
+  }
+
+  const char* kUsage = "usage: Steering.Bench [--agents 100,1000] [--ticks n] [--warmup n] [--seed n]\n"
+    "                      [--threads n] [--mode name]\n";
+
+  void runMode(const Body::SteeringMode mode, const uint32_t n_agents, const uint32_t ticks,
+    const uint32_t warmup, const uint64_t seed) {
+    World world;
+    world.init(n_agents, seed);
+    world.ia()->setSteering(mode);
+    scatterHeadings(&world, seed);
+
+    std::vector<Command> commands;
+    commands.reserve(4);
+    for (uint32_t t = 0; t < warmup; ++t) {
+      driveTarget(world.tick(), &commands);
+      world.step(commands);
+    }
+
+    const uint64_t allocs = g_allocs.load();
+    const uint64_t alloc_bytes = g_alloc_bytes.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < ticks; ++t) {
+      driveTarget(world.tick(), &commands);
+      world.step(commands);
+    }
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%s,%u,%u,%u,%.6f,%.2f,%.2f,%llu,%llu,%016llx\n", Body::steeringName(mode), n_agents, ticks,
+      WorkerPool::instance().size(), secs, ticks / secs, (secs * 1e9) / ((double)ticks * n_agents),
+      (unsigned long long)(g_allocs.load() - allocs), (unsigned long long)(g_alloc_bytes.load() - alloc_bytes),
+      (unsigned long long)world.checksum());
+    fflush(stdout);
+  }
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+int main(int argc, char* argv[]) {
+  std::vector<uint32_t> agent_counts;
+  uint32_t ticks = 200;
+  uint32_t warmup = 10;
+  uint32_t threads = 0;
+  uint64_t seed = 1;
+  const char* only_mode = nullptr;
+  for (int i = 1; i < argc; i += 2) {
+    if (i + 1 == argc) {
+      fprintf(stderr, "Missing value for %s\n%s", argv[i], kUsage);
+      return 1;
+    }
+    if (!strcmp(argv[i], "--agents")) {
+      for (char* s = strtok(argv[i + 1], ","); s; s = strtok(nullptr, ",")) {
+        agent_counts.push_back((uint32_t)atoi(s));
+      }
+    } else if (!strcmp(argv[i], "--ticks")) {
+      ticks = (uint32_t)atoi(argv[i + 1]);
+    } else if (!strcmp(argv[i], "--warmup")) {
+      warmup = (uint32_t)atoi(argv[i + 1]);
+    } else if (!strcmp(argv[i], "--threads")) {
+      threads = (uint32_t)atoi(argv[i + 1]);
+    } else if (!strcmp(argv[i], "--seed")) {
+      seed = strtoull(argv[i + 1], nullptr, 10);
+    } else if (!strcmp(argv[i], "--mode")) {
+      only_mode = argv[i + 1];
+    } else {
+      fprintf(stderr, "Unknown option %s\n%s", argv[i], kUsage);
+      return 1;
+    }
+  }
+  if (agent_counts.empty()) {
+    agent_counts = { 100, 1000 };
+  }
+  if (ticks == 0) ticks = 1;
+
+  //every mode in enum order, or only the one named by --mode
+  std::vector<Body::SteeringMode> modes;
+  for (uint32_t m = 0; m < Body::steering_modes_; ++m) {
+    const Body::SteeringMode mode = (Body::SteeringMode)m;
+    if (!only_mode || !strcmp(only_mode, Body::steeringName(mode))) {
+      modes.push_back(mode);
+    }
+  }
+  if (modes.empty()) {
+    fprintf(stderr, "Unknown mode %s\n%s", only_mode, kUsage);
+    return 1;
+  }
+
+  WorkerPool::instance().init(threads);
+
+  printf("mode,agents,ticks,threads,seconds,ticks_per_sec,ns_per_agent_tick,allocs,alloc_bytes,checksum\n");
+  for (const Body::SteeringMode mode : modes) {
+    for (const uint32_t n_agents : agent_counts) {
+      runMode(mode, n_agents, ticks, warmup, seed);
+    }
+  }
+
+  WorkerPool::instance().shutdown();
+  return 0;
+}